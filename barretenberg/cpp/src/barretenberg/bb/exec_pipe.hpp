@@ -1,23 +1,39 @@
 #pragma once
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <iostream>
 #include <vector>
 
-inline std::vector<uint8_t> exec_pipe(std::string const& command)
+/**
+ * Runs `command` and returns everything it writes to stdout. If the size of the output is known up front, passing it
+ * as `size_hint` lets the output be read straight into a buffer of the right size. A wrong hint only costs a larger
+ * reservation or extra reallocations.
+ */
+inline std::vector<uint8_t> exec_pipe(std::string const& command, size_t size_hint = 0)
 {
     FILE* pipe = popen(command.c_str(), "r");
     if (!pipe) {
         throw std::runtime_error("popen() failed!");
     }
 
+    constexpr size_t CHUNK_SIZE = 1 << 16;
     std::vector<uint8_t> result;
-    while (!feof(pipe)) {
-        uint8_t buffer[128];
-        size_t count = fread(buffer, 1, sizeof(buffer), pipe);
-        result.insert(result.end(), buffer, buffer + count);
+    // One spare byte, so that reaching the end of an output of exactly `size_hint` bytes does not grow the buffer
+    result.reserve(std::max(size_hint + 1, CHUNK_SIZE));
+    while (true) {
+        // Grow by one chunk at a time, within the reserved capacity while some is left, so that only the bytes about
+        // to be read are zero-filled
+        const size_t size = result.size();
+        const size_t spare_capacity = result.capacity() - size;
+        result.resize(size + (spare_capacity > 0 ? std::min(spare_capacity, CHUNK_SIZE) : CHUNK_SIZE));
+        const size_t count = fread(result.data() + size, 1, result.size() - size, pipe);
+        result.resize(size + count);
+        if (count == 0) {
+            break;
+        }
     }
 
     pclose(pipe);
     return result;
-}
\ No newline at end of file
+}
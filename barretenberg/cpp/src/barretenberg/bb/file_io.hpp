@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <barretenberg/common/log.hpp>
 #include <fstream>
 #include <ios>
@@ -28,6 +29,42 @@ inline std::vector<uint8_t> read_file(const std::string& filename, size_t bytes
     return fileData;
 }
 
+/**
+ * @brief Returns the uncompressed size recorded in the trailer of a gzip file, or 0 if it cannot be read.
+ *
+ * @details The trailer only holds the size modulo 2^32 and only describes the last member of the file, so the result
+ * is a hint for sizing buffers rather than something to rely on. It is 0 for files without the gzip magic bytes, and
+ * is capped at MAX_GZIP_SIZE_HINT_RATIO times the size of the file, so a corrupt trailer cannot make callers reserve
+ * gigabytes up front.
+ */
+inline size_t get_gzip_uncompressed_size(const std::string& filename)
+{
+    constexpr size_t MAX_GZIP_SIZE_HINT_RATIO = 16;
+    // A 10 byte header and an 8 byte trailer
+    constexpr std::streamoff MIN_GZIP_FILE_SIZE = 18;
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return 0;
+    }
+    const std::streamoff file_size = file.tellg();
+    if (file_size < MIN_GZIP_FILE_SIZE) {
+        return 0;
+    }
+    uint8_t magic[2];
+    file.seekg(0, std::ios::beg);
+    if (!file.read(reinterpret_cast<char*>(magic), sizeof(magic)) || magic[0] != 0x1f || magic[1] != 0x8b) {
+        return 0;
+    }
+    uint8_t trailer[4];
+    file.seekg(-4, std::ios::end);
+    if (!file.read(reinterpret_cast<char*>(trailer), sizeof(trailer))) {
+        return 0;
+    }
+    const size_t size =
+        (size_t)trailer[0] | ((size_t)trailer[1] << 8) | ((size_t)trailer[2] << 16) | ((size_t)trailer[3] << 24);
+    return std::min(size, MAX_GZIP_SIZE_HINT_RATIO * (size_t)file_size);
+}
+
 inline void write_file(const std::string& filename, std::vector<uint8_t> const& data)
 {
     std::ofstream file(filename, std::ios::binary);
@@ -1,5 +1,6 @@
 #pragma once
 #include "exec_pipe.hpp"
+#include "file_io.hpp"
 
 /**
  * We can assume for now we're running on a unix like system and use the following to extract the bytecode.
@@ -7,5 +8,5 @@
 inline std::vector<uint8_t> get_bytecode(const std::string& bytecodePath)
 {
     std::string command = "gunzip -c \"" + bytecodePath + "\"";
-    return exec_pipe(command);
-}
\ No newline at end of file
+    return exec_pipe(command, get_gzip_uncompressed_size(bytecodePath));
+}
@@ -2,11 +2,22 @@
 #include "exec_pipe.hpp"
 #include "file_io.hpp"
 #include "log.hpp"
+#include <algorithm>
+#include <atomic>
 #include <barretenberg/ecc/curves/bn254/g1.hpp>
 #include <barretenberg/srs/io.hpp>
 #include <filesystem>
 #include <fstream>
 #include <ios>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Byte offsets and sizes within the first ignition transcript file.
+constexpr size_t TRANSCRIPT_G1_START = 28;
+constexpr size_t TRANSCRIPT_G1_POINT_SIZE = 64;
+constexpr size_t TRANSCRIPT_G2_START = TRANSCRIPT_G1_START + 5040001 * TRANSCRIPT_G1_POINT_SIZE;
+constexpr size_t TRANSCRIPT_G2_POINT_SIZE = 128;
 
 // Gets the transcript URL from the BARRETENBERG_TRANSCRIPT_URL environment variable, if set.
 // Otherwise returns the default URL.
@@ -22,39 +33,123 @@ inline std::string getTranscriptURL()
     return environment_variable_exists ? std::string(env_url) : DEFAULT_URL;
 }
 
-inline std::vector<uint8_t> download_g1_data(size_t num_points)
-{
-    size_t g1_start = 28;
-    size_t g1_end = g1_start + num_points * 64 - 1;
+/**
+ * @brief Where transcript bytes come from. read_range may be called from several threads at once.
+ */
+class CrsRangeSource {
+  public:
+    virtual ~CrsRangeSource() = default;
+    // Bytes [start, start + length) of the transcript. Fewer bytes than asked for means the range could not be read.
+    virtual std::vector<uint8_t> read_range(size_t start, size_t length) = 0;
+};
+
+/**
+ * @brief Fetches ranges over HTTP(S) with one curl process per request.
+ */
+class CurlRangeSource : public CrsRangeSource {
+  public:
+    explicit CurlRangeSource(std::string url)
+        : url_(std::move(url))
+    {}
 
-    std::string url = getTranscriptURL();
+    std::vector<uint8_t> read_range(size_t start, size_t length) override
+    {
+        std::string command = "curl -s -f -H \"Range: bytes=" + std::to_string(start) + "-" +
+                              std::to_string(start + length - 1) + "\" '" + url_ + "'";
+        auto data = exec_pipe(command);
+        // A server that ignores the range header sends the whole file.
+        if (data.size() > length) {
+            data.clear();
+        }
+        return data;
+    }
+
+  private:
+    std::string url_;
+};
 
-    std::string command =
-        "curl -s -H \"Range: bytes=" + std::to_string(g1_start) + "-" + std::to_string(g1_end) + "\" '" + url + "'";
+/**
+ * @brief Reads ranges from a local copy of the transcript, e.g. a mirror on shared storage or a test fixture.
+ */
+class FileRangeSource : public CrsRangeSource {
+  public:
+    explicit FileRangeSource(std::filesystem::path path)
+        : path_(std::move(path))
+    {}
 
-    auto data = exec_pipe(command);
-    // Header + num_points * sizeof point.
-    if (data.size() < g1_end - g1_start) {
-        throw std::runtime_error("Failed to download g1 data.");
+    std::vector<uint8_t> read_range(size_t start, size_t length) override
+    {
+        std::ifstream file(path_, std::ios::binary);
+        std::vector<uint8_t> data(length);
+        file.seekg(static_cast<std::streamoff>(start));
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(length));
+        data.resize(file ? length : static_cast<size_t>(std::max(file.gcount(), std::streamsize(0))));
+        return data;
     }
 
-    return exec_pipe(command);
-}
+  private:
+    std::filesystem::path path_;
+};
 
-inline std::vector<uint8_t> download_g2_data()
+// A file:// URL is read directly, anything else through curl.
+inline std::shared_ptr<CrsRangeSource> make_crs_range_source(std::string const& url)
 {
-    size_t g2_start = 28 + 5040001 * 64;
-    size_t g2_end = g2_start + 128 - 1;
-
-    std::string url = getTranscriptURL();
+    const std::string FILE_SCHEME = "file://";
+    if (url.starts_with(FILE_SCHEME)) {
+        return std::make_shared<FileRangeSource>(url.substr(FILE_SCHEME.size()));
+    }
+    return std::make_shared<CurlRangeSource>(url);
+}
 
-    std::string command =
-        "curl -s -H \"Range: bytes=" + std::to_string(g2_start) + "-" + std::to_string(g2_end) + "\" '" + url + "'";
+struct CrsDownloadOptions {
+    // Points per range request.
+    size_t chunk_points = 1 << 16;
+    // Range requests in flight at once. Each also validates its own chunk, so this is the validation parallelism too.
+    size_t num_connections = 8;
+    // Attempts per chunk before giving up.
+    size_t max_attempts = 3;
+};
 
-    return exec_pipe(command);
+/**
+ * @brief Convert transcript bytes of num_points G1 points into `points`, checking that every point is on the curve and
+ * that the first point of the transcript is the generator.
+ *
+ * @details This catches truncated, zeroed and bit-flipped data (a random 64 bytes is almost never a curve point), and
+ * G1 has cofactor 1 so an on-curve point is always in the right group. It does not check that point i is [x^i]G for
+ * the same x throughout: a well-formed transcript with different points, or with points swapped, is accepted. Doing so
+ * needs a pairing check against the G2 point, which would be a second download and a pairing per chunk. Proofs made
+ * with such a CRS fail to verify against the real one; the transcript is otherwise trusted to be the ignition one by
+ * way of the URL it is fetched from.
+ */
+inline bool read_and_validate_g1_points(uint8_t const* data,
+                                        size_t first_point,
+                                        size_t num_points,
+                                        barretenberg::g1::affine_element* points)
+{
+    barretenberg::srs::IO<curve::BN254>::read_affine_elements_from_buffer(
+        points, (char const*)data, num_points * TRANSCRIPT_G1_POINT_SIZE);
+    for (size_t i = 0; i < num_points; ++i) {
+        if (!points[i].on_curve()) {
+            return false;
+        }
+    }
+    return first_point != 0 || num_points == 0 || points[0] == barretenberg::g1::affine_one;
 }
 
-inline std::vector<barretenberg::g1::affine_element> get_g1_data(const std::filesystem::path& path, size_t num_points)
+/**
+ * @brief Make sure the cache at `path` holds at least num_points G1 points, and return the first num_points.
+ *
+ * @details The cache is g1.dat (the G1 section of the transcript, as downloaded) and `size` (how many points of it
+ * have been validated). A short cache is grown from its current size rather than downloaded again. The missing
+ * points are fetched in chunks by num_connections workers; each worker validates its own chunk before writing it.
+ * g1.dat is extended to its new length up front and `size` is only raised once every chunk is in, so an interrupted
+ * download leaves chunks behind it. The next run validates whatever is already in place and only fetches the chunks
+ * that fail.
+ */
+inline std::vector<barretenberg::g1::affine_element> get_g1_data(const std::filesystem::path& path,
+                                                                 size_t num_points,
+                                                                 CrsRangeSource& source,
+                                                                 CrsDownloadOptions const& options = {})
 {
     std::filesystem::create_directories(path);
     std::ifstream size_file(path / "size");
@@ -63,47 +158,133 @@ inline std::vector<barretenberg::g1::affine_element> get_g1_data(const std::file
         size_file >> size;
         size_file.close();
     }
-    if (size >= num_points) {
+    const std::filesystem::path g1_path = path / "g1.dat";
+    if (!std::filesystem::exists(g1_path)) {
+        size = 0;
+    }
+
+    auto points = std::vector<barretenberg::g1::affine_element>(num_points);
+    const size_t num_cached = std::min(size, num_points);
+    if (num_cached > 0) {
         vinfo("using cached crs at: ", path);
-        auto data = read_file(path / "g1.dat", 28 + num_points * 64);
-        auto points = std::vector<barretenberg::g1::affine_element>(num_points);
-        auto size_of_points_in_bytes = num_points * 64;
+        auto data = read_file(g1_path, num_cached * TRANSCRIPT_G1_POINT_SIZE);
         barretenberg::srs::IO<curve::BN254>::read_affine_elements_from_buffer(
-            points.data(), (char*)data.data(), size_of_points_in_bytes);
+            points.data(), (char*)data.data(), num_cached * TRANSCRIPT_G1_POINT_SIZE);
+    }
+    if (size >= num_points) {
         return points;
     }
 
-    vinfo("downloading crs...");
-    auto data = download_g1_data(num_points);
-    write_file(path / "g1.dat", data);
+    vinfo("downloading crs points ", size, " to ", num_points, "...");
+    const size_t g1_size = num_points * TRANSCRIPT_G1_POINT_SIZE;
+    if (!std::filesystem::exists(g1_path) || std::filesystem::file_size(g1_path) < g1_size) {
+        std::ofstream(g1_path, std::ios::binary | std::ios::app).close();
+        std::filesystem::resize_file(g1_path, g1_size);
+    }
+
+    const size_t chunk_points = std::max(options.chunk_points, size_t(1));
+    const size_t num_chunks = (num_points - size + chunk_points - 1) / chunk_points;
+    std::atomic<size_t> next_chunk = 0;
+    std::atomic<size_t> num_downloaded = 0;
+    std::mutex error_mutex;
+    std::string error;
+    auto worker = [&]() {
+        std::fstream file(g1_path, std::ios::binary | std::ios::in | std::ios::out);
+        for (size_t chunk = next_chunk++; chunk < num_chunks && file; chunk = next_chunk++) {
+            const size_t start = size + chunk * chunk_points;
+            const size_t count = std::min(chunk_points, num_points - start);
+            const size_t length = count * TRANSCRIPT_G1_POINT_SIZE;
+            const auto offset = static_cast<std::streamoff>(start * TRANSCRIPT_G1_POINT_SIZE);
+
+            // Left behind by an interrupted download?
+            std::vector<uint8_t> data(length);
+            file.seekg(offset);
+            file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(length));
+            if (file && read_and_validate_g1_points(data.data(), start, count, &points[start])) {
+                continue;
+            }
+            file.clear();
 
-    std::ofstream new_size_file(path / "size");
+            bool valid = false;
+            for (size_t attempt = 0; attempt < options.max_attempts && !valid; ++attempt) {
+                data = source.read_range(TRANSCRIPT_G1_START + start * TRANSCRIPT_G1_POINT_SIZE, length);
+                valid = data.size() == length && read_and_validate_g1_points(data.data(), start, count, &points[start]);
+            }
+            if (!valid) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                error = "Failed to download valid g1 points " + std::to_string(start) + " to " +
+                        std::to_string(start + count) + ".";
+                next_chunk = num_chunks;
+                break;
+            }
+            file.seekp(offset);
+            file.write(reinterpret_cast<char const*>(data.data()), static_cast<std::streamsize>(length));
+            num_downloaded += count;
+        }
+        if (!file) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            error = "Failed to write " + g1_path.string() + ".";
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < std::min(std::max(options.num_connections, size_t(1)), num_chunks); ++i) {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers) {
+        thread.join();
+    }
+    if (!error.empty()) {
+        throw std::runtime_error(error);
+    }
+    vinfo("downloaded ", num_downloaded.load(), " crs points");
+
+    // Replace the size file in one step, so it never claims points that are not there.
+    const std::filesystem::path size_path = path / "size";
+    const std::filesystem::path new_size_path = path / "size.tmp";
+    std::ofstream new_size_file(new_size_path);
     if (!new_size_file) {
         throw std::runtime_error("Failed to open size file for writing");
     }
     new_size_file << num_points;
     new_size_file.close();
-
-    auto points = std::vector<barretenberg::g1::affine_element>(num_points);
-    barretenberg::srs::IO<curve::BN254>::read_affine_elements_from_buffer(
-        points.data(), (char*)data.data(), data.size());
+    std::filesystem::rename(new_size_path, size_path);
     return points;
 }
 
-inline barretenberg::g2::affine_element get_g2_data(const std::filesystem::path& path)
+inline std::vector<barretenberg::g1::affine_element> get_g1_data(const std::filesystem::path& path, size_t num_points)
+{
+    auto source = make_crs_range_source(getTranscriptURL());
+    return get_g1_data(path, num_points, *source);
+}
+
+inline barretenberg::g2::affine_element get_g2_data(const std::filesystem::path& path, CrsRangeSource& source)
 {
     std::filesystem::create_directories(path);
 
     try {
         auto data = read_file(path / "g2.dat");
         barretenberg::g2::affine_element g2_point;
-        barretenberg::srs::IO<curve::BN254>::read_affine_elements_from_buffer(&g2_point, (char*)data.data(), 128);
+        barretenberg::srs::IO<curve::BN254>::read_affine_elements_from_buffer(
+            &g2_point, (char*)data.data(), TRANSCRIPT_G2_POINT_SIZE);
         return g2_point;
     } catch (std::exception&) {
-        auto data = download_g2_data();
-        write_file(path / "g2.dat", data);
+        auto data = source.read_range(TRANSCRIPT_G2_START, TRANSCRIPT_G2_POINT_SIZE);
+        if (data.size() != TRANSCRIPT_G2_POINT_SIZE) {
+            throw std::runtime_error("Failed to download g2 data.");
+        }
         barretenberg::g2::affine_element g2_point;
-        barretenberg::srs::IO<curve::BN254>::read_affine_elements_from_buffer(&g2_point, (char*)data.data(), 128);
+        barretenberg::srs::IO<curve::BN254>::read_affine_elements_from_buffer(
+            &g2_point, (char*)data.data(), TRANSCRIPT_G2_POINT_SIZE);
+        if (!g2_point.on_curve()) {
+            throw std::runtime_error("Downloaded g2 point is not on the curve.");
+        }
+        write_file(path / "g2.dat", data);
         return g2_point;
     }
-}
\ No newline at end of file
+}
+
+inline barretenberg::g2::affine_element get_g2_data(const std::filesystem::path& path)
+{
+    auto source = make_crs_range_source(getTranscriptURL());
+    return get_g2_data(path, *source);
+}
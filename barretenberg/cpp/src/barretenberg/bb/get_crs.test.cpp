@@ -0,0 +1,158 @@
+#include "get_crs.hpp"
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+namespace {
+
+using namespace barretenberg;
+
+constexpr size_t NUM_TRANSCRIPT_POINTS = 3000;
+
+// Chunks small enough that every fetch below is split across several workers.
+const CrsDownloadOptions OPTIONS{ .chunk_points = 64, .num_connections = 4, .max_attempts = 3 };
+
+class GetCrsTests : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        dir = std::filesystem::temp_directory_path() /
+              ("bb_get_crs_test_" + std::to_string(getpid()) + "_" +
+               ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+
+        // A transcript in the ignition format whose points are random, apart from the generator in front.
+        points.resize(NUM_TRANSCRIPT_POINTS);
+        points[0] = g1::affine_one;
+        for (size_t i = 1; i < NUM_TRANSCRIPT_POINTS; ++i) {
+            points[i] = g1::affine_element(g1::element::random_element());
+        }
+        std::filesystem::create_directories(dir / "monomial");
+        srs::Manifest manifest{ 0, 1, NUM_TRANSCRIPT_POINTS, 0, NUM_TRANSCRIPT_POINTS, 0, 0 };
+        srs::IO<curve::BN254>::write_transcript(points.data(), manifest, dir.string());
+        transcript_path = dir / "monomial" / "transcript00.dat";
+        cache_path = dir / "cache";
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir); }
+
+    void expect_transcript_prefix(std::vector<g1::affine_element> const& fetched, size_t num_points)
+    {
+        ASSERT_EQ(fetched.size(), num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            EXPECT_EQ(fetched[i], points[i]) << "point " << i;
+        }
+    }
+
+    size_t cached_size()
+    {
+        size_t size = 0;
+        std::ifstream(cache_path / "size") >> size;
+        return size;
+    }
+
+    // Overwrite point `index` of the cached g1.dat with `bytes`.
+    void overwrite_cached_point(size_t index, std::vector<uint8_t> const& bytes)
+    {
+        std::fstream file(cache_path / "g1.dat", std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(index * TRANSCRIPT_G1_POINT_SIZE));
+        file.write(reinterpret_cast<char const*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    std::filesystem::path dir;
+    std::filesystem::path transcript_path;
+    std::filesystem::path cache_path;
+    std::vector<g1::affine_element> points;
+};
+
+// Serves a transcript whose chunk at [bad_start, bad_start + bad_length) has been zeroed out.
+class CorruptRangeSource : public CrsRangeSource {
+  public:
+    CorruptRangeSource(std::filesystem::path path, size_t bad_start, size_t bad_length)
+        : source_(std::move(path))
+        , bad_start_(bad_start)
+        , bad_length_(bad_length)
+    {}
+
+    std::vector<uint8_t> read_range(size_t start, size_t length) override
+    {
+        auto data = source_.read_range(start, length);
+        for (size_t i = 0; i < data.size(); ++i) {
+            if (start + i >= bad_start_ && start + i < bad_start_ + bad_length_) {
+                data[i] = 0;
+            }
+        }
+        return data;
+    }
+
+  private:
+    FileRangeSource source_;
+    size_t bad_start_;
+    size_t bad_length_;
+};
+
+} // namespace
+
+TEST_F(GetCrsTests, FullFetch)
+{
+    FileRangeSource source(transcript_path);
+    expect_transcript_prefix(get_g1_data(cache_path, NUM_TRANSCRIPT_POINTS, source, OPTIONS), NUM_TRANSCRIPT_POINTS);
+    EXPECT_EQ(cached_size(), NUM_TRANSCRIPT_POINTS);
+
+    // Served from the cache from now on, even for fewer points
+    FileRangeSource no_source(dir / "missing");
+    expect_transcript_prefix(get_g1_data(cache_path, 100, no_source, OPTIONS), 100);
+    expect_transcript_prefix(get_g1_data(cache_path, NUM_TRANSCRIPT_POINTS, no_source, OPTIONS),
+                             NUM_TRANSCRIPT_POINTS);
+}
+
+TEST_F(GetCrsTests, GrowsCache)
+{
+    FileRangeSource source(transcript_path);
+    expect_transcript_prefix(get_g1_data(cache_path, 1000, source, OPTIONS), 1000);
+    EXPECT_EQ(cached_size(), 1000U);
+    expect_transcript_prefix(get_g1_data(cache_path, 2500, source, OPTIONS), 2500);
+    EXPECT_EQ(cached_size(), 2500U);
+}
+
+TEST_F(GetCrsTests, ResumesInterruptedFetch)
+{
+    FileRangeSource source(transcript_path);
+    get_g1_data(cache_path, NUM_TRANSCRIPT_POINTS, source, OPTIONS);
+
+    // What an interrupted grow from 1000 points leaves behind: g1.dat already at its new length, `size` not yet
+    // raised, and a chunk that never arrived.
+    std::ofstream(cache_path / "size") << 1000;
+    overwrite_cached_point(2000, std::vector<uint8_t>(TRANSCRIPT_G1_POINT_SIZE, 0));
+
+    // The chunks already in place are kept and only the missing one is fetched again: anything before it comes back
+    // corrupt from this source
+    const size_t missing_chunk_start = 1000 + (2000 - 1000) / OPTIONS.chunk_points * OPTIONS.chunk_points;
+    CorruptRangeSource only_missing_chunk(
+        transcript_path, 0, TRANSCRIPT_G1_START + missing_chunk_start * TRANSCRIPT_G1_POINT_SIZE);
+    expect_transcript_prefix(get_g1_data(cache_path, NUM_TRANSCRIPT_POINTS, only_missing_chunk, OPTIONS),
+                             NUM_TRANSCRIPT_POINTS);
+    EXPECT_EQ(cached_size(), NUM_TRANSCRIPT_POINTS);
+}
+
+TEST_F(GetCrsTests, RejectsCorruptChunk)
+{
+    // Point 1500 is zeroed on every attempt, so its chunk never validates
+    const size_t bad_start = TRANSCRIPT_G1_START + 1500 * TRANSCRIPT_G1_POINT_SIZE;
+    CorruptRangeSource source(transcript_path, bad_start, TRANSCRIPT_G1_POINT_SIZE);
+    EXPECT_THROW(get_g1_data(cache_path, 2000, source, OPTIONS), std::runtime_error);
+    EXPECT_EQ(cached_size(), 0U);
+
+    // Nor is a first point other than the generator accepted
+    std::filesystem::remove_all(cache_path);
+    std::filesystem::create_directories(dir / "shifted" / "monomial");
+    srs::IO<curve::BN254>::write_transcript(&points[1], { 0, 1, 1, 0, 1, 0, 0 }, (dir / "shifted").string());
+    FileRangeSource shifted(dir / "shifted" / "monomial" / "transcript00.dat");
+    EXPECT_THROW(get_g1_data(cache_path, 1, shifted, OPTIONS), std::runtime_error);
+}
+
+TEST_F(GetCrsTests, RejectsUnreadableSource)
+{
+    FileRangeSource source(dir / "missing");
+    EXPECT_THROW(get_g1_data(cache_path, 10, source, OPTIONS), std::runtime_error);
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "exec_pipe.hpp"
+#include "file_io.hpp"
 
 /**
  * We can assume for now we're running on a unix like system and use the following to extract the bytecode.
@@ -7,6 +8,6 @@
  */
 inline std::vector<uint8_t> get_witness_data(const std::string& path)
 {
-    std::string command = "cat " + path + " | gunzip";
-    return exec_pipe(command);
-}
\ No newline at end of file
+    std::string command = "gunzip -c \"" + path + "\"";
+    return exec_pipe(command, get_gzip_uncompressed_size(path));
+}
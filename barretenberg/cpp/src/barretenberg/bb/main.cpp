@@ -6,6 +6,7 @@
 #include "get_crs.hpp"
 #include "get_witness.hpp"
 #include "log.hpp"
+#include "serve.hpp"
 #include <barretenberg/common/benchmark.hpp>
 #include <barretenberg/common/container.hpp>
 #include <barretenberg/common/timer.hpp>
@@ -19,6 +20,8 @@
 
 using namespace barretenberg;
 std::string CRS_PATH = "./crs";
+// How the prover CRS is kept in memory, see ProverCrsConfig. Its files live in CRS_PATH.
+srs::factories::ProverCrsConfig PROVER_CRS_CONFIG;
 bool verbose = false;
 
 const std::filesystem::path current_path = std::filesystem::current_path();
@@ -33,7 +36,7 @@ acir_proofs::AcirComposer init(acir_format::acir_format& constraint_system)
     // Must +1!
     auto g1_data = get_g1_data(CRS_PATH, subgroup_size + 1);
     auto g2_data = get_g2_data(CRS_PATH);
-    srs::init_crs_factory(g1_data, g2_data);
+    srs::init_crs_factory(g1_data, g2_data, PROVER_CRS_CONFIG, CRS_PATH);
 
     return acir_composer;
 }
@@ -129,6 +132,42 @@ void prove(const std::string& bytecodePath,
     }
 }
 
+/**
+ * @brief Creates proofs of one ACIR circuit for many witnesses
+ *
+ * The circuit and proving key are built once, and the proofs run concurrently as memory allows.
+ *
+ * Communication:
+ * - Filesystem: The proof for the i-th witness is written to outputDir/proof_i
+ *
+ * @param bytecodePath Path to the file containing the serialized circuit
+ * @param witnessPaths Paths to the files containing the serialized witnesses
+ * @param recursive Whether to use recursive proof generation of non-recursive
+ * @param outputDir Directory to write the proofs to
+ * @param memoryBudget Memory the concurrent proofs may use, in bytes, or 0 to run one per cpu
+ */
+void proveBatch(const std::string& bytecodePath,
+                const std::vector<std::string>& witnessPaths,
+                bool recursive,
+                const std::string& outputDir,
+                size_t memoryBudget)
+{
+    auto constraint_system = get_constraint_system(bytecodePath);
+    std::vector<acir_format::WitnessVector> witnesses;
+    witnesses.reserve(witnessPaths.size());
+    for (auto const& witness_path : witnessPaths) {
+        witnesses.push_back(get_witness(witness_path));
+    }
+    auto acir_composer = init(constraint_system);
+    auto proofs = acir_composer.create_proofs(constraint_system, witnesses, recursive, memoryBudget);
+
+    std::filesystem::create_directories(outputDir);
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        write_file(outputDir + "/proof_" + std::to_string(i), proofs[i]);
+    }
+    vinfo(proofs.size(), " proofs written to: ", outputDir);
+}
+
 /**
  * @brief Computes the number of Barretenberg specific gates needed to create a proof for the specific ACIR circuit
  *
@@ -352,6 +391,26 @@ void acvm_info(const std::string& output_path)
     }
 }
 
+/**
+ * @brief Runs as a prover daemon, answering requests until its input is closed (or forever, on a socket)
+ *
+ * Communication:
+ * - stdin/stdout, or the unix socket at socket_path if one is given: length-prefixed msgpack requests and responses,
+ *   see serve.hpp
+ *
+ * @param socket_path Path of the unix socket to listen on, or empty to use stdin and stdout
+ * @param max_cached_circuits How many circuits to keep keys for
+ * @param socket_mode File mode of the socket, which decides who may connect to it
+ */
+void serve(const std::string& socket_path, size_t max_cached_circuits, mode_t socket_mode)
+{
+    if (socket_path.empty()) {
+        serve_stdio(CRS_PATH, max_cached_circuits, PROVER_CRS_CONFIG);
+    } else {
+        serve_socket(CRS_PATH, socket_path, max_cached_circuits, socket_mode, PROVER_CRS_CONFIG);
+    }
+}
+
 bool flag_present(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -363,6 +422,18 @@ std::string get_option(std::vector<std::string>& args, const std::string& option
     return (itr != args.end() && std::next(itr) != args.end()) ? *(std::next(itr)) : defaultValue;
 }
 
+// Every value given for a repeatable option, in order.
+std::vector<std::string> get_options(std::vector<std::string>& args, const std::string& option)
+{
+    std::vector<std::string> values;
+    for (auto itr = args.begin(); itr != args.end() && std::next(itr) != args.end(); ++itr) {
+        if (*itr == option) {
+            values.push_back(*std::next(itr));
+        }
+    }
+    return values;
+}
+
 int main(int argc, char* argv[])
 {
     try {
@@ -382,6 +453,9 @@ int main(int argc, char* argv[])
         std::string vk_path = get_option(args, "-k", "./target/vk");
         std::string pk_path = get_option(args, "-r", "./target/pk");
         CRS_PATH = get_option(args, "-c", "./crs");
+        PROVER_CRS_CONFIG.map_points = flag_present(args, "--map_crs");
+        PROVER_CRS_CONFIG.fixed_base.memory_budget = std::stoul(get_option(args, "--fixed_base_mb", "0")) << 20;
+        PROVER_CRS_CONFIG.fixed_base.persist = flag_present(args, "--persist_fixed_base");
         bool recursive = flag_present(args, "-r") || flag_present(args, "--recursive");
 
         // Skip CRS initialization for any command which doesn't require the CRS.
@@ -401,6 +475,10 @@ int main(int argc, char* argv[])
         if (command == "prove") {
             std::string output_path = get_option(args, "-o", "./proofs/proof");
             prove(bytecode_path, witness_path, recursive, output_path);
+        } else if (command == "prove_batch") {
+            std::string output_dir = get_option(args, "-o", "./proofs");
+            size_t memory_budget = std::stoul(get_option(args, "-m", "0")) << 20;
+            proveBatch(bytecode_path, get_options(args, "-w"), recursive, output_dir, memory_budget);
         } else if (command == "gates") {
             gateCount(bytecode_path);
         } else if (command == "verify") {
@@ -417,6 +495,10 @@ int main(int argc, char* argv[])
         } else if (command == "proof_as_fields") {
             std::string output_path = get_option(args, "-o", proof_path + "_fields.json");
             proof_as_fields(proof_path, vk_path, output_path);
+        } else if (command == "serve") {
+            std::string socket_path = get_option(args, "-s", "");
+            auto socket_mode = static_cast<mode_t>(std::stoul(get_option(args, "--socket_mode", "600"), nullptr, 8));
+            serve(socket_path, std::stoul(get_option(args, "-n", "16")), socket_mode);
         } else if (command == "vk_as_fields") {
             std::string output_path = get_option(args, "-o", vk_path + "_fields.json");
             vk_as_fields(vk_path, output_path);
@@ -0,0 +1,402 @@
+#pragma once
+#include "get_crs.hpp"
+#include "log.hpp"
+#include <algorithm>
+#include <barretenberg/common/mem.hpp>
+#include <barretenberg/common/serialize.hpp>
+#include <barretenberg/crypto/sha256/sha256.hpp>
+#include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
+#include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
+#include <barretenberg/plonk/proof_system/verification_key/verification_key.hpp>
+#include <barretenberg/serialize/cbind.hpp>
+#include <barretenberg/srs/global_crs.hpp>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * A request to `bb serve`. Which fields are used depends on the command:
+ * - prove, prove_and_verify: bytecode, witness, recursive
+ * - verify: bytecode, proof, recursive
+ * - write_vk, gates: bytecode
+ * Bytecode and witness are the uncompressed buffers (what `gunzip` gives for the files the other commands read).
+ */
+struct ServeRequest {
+    uint64_t id = 0;
+    std::string command;
+    std::vector<uint8_t> bytecode;
+    std::vector<uint8_t> witness;
+    std::vector<uint8_t> proof;
+    bool recursive = false;
+    MSGPACK_FIELDS(id, command, bytecode, witness, proof, recursive);
+};
+
+/**
+ * The response to the request with the same id. `data` is the proof (prove), the verification key (write_vk) or the
+ * little endian gate count (gates), `verified` the result of verify and prove_and_verify.
+ */
+struct ServeResponse {
+    uint64_t id = 0;
+    bool success = false;
+    std::string error;
+    std::vector<uint8_t> data;
+    bool verified = false;
+    MSGPACK_FIELDS(id, success, error, data, verified);
+};
+
+// Larger frames are taken to be a corrupt stream rather than a request.
+constexpr uint32_t SERVE_MAX_FRAME_SIZE = 1U << 30;
+
+// Each frame is a 4 byte little endian length followed by that many bytes of msgpack.
+inline bool read_frame(int fd, std::vector<uint8_t>& frame)
+{
+    auto read_exact = [fd](uint8_t* data, size_t size) {
+        while (size > 0) {
+            const ssize_t count = ::read(fd, data, size);
+            if (count <= 0) {
+                return false;
+            }
+            data += count;
+            size -= static_cast<size_t>(count);
+        }
+        return true;
+    };
+    uint8_t length_bytes[4];
+    if (!read_exact(length_bytes, sizeof(length_bytes))) {
+        return false;
+    }
+    uint32_t length = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        length |= static_cast<uint32_t>(length_bytes[i]) << (8 * i);
+    }
+    if (length > SERVE_MAX_FRAME_SIZE) {
+        return false;
+    }
+    frame.resize(length);
+    return read_exact(frame.data(), length);
+}
+
+inline bool write_frame(int fd, std::vector<uint8_t> const& body)
+{
+    std::vector<uint8_t> frame(4 + body.size());
+    for (size_t i = 0; i < 4; ++i) {
+        frame[i] = static_cast<uint8_t>(body.size() >> (8 * i));
+    }
+    std::copy(body.begin(), body.end(), frame.begin() + 4);
+    const uint8_t* data = frame.data();
+    size_t size = frame.size();
+    while (size > 0) {
+        const ssize_t count = ::write(fd, data, size);
+        if (count <= 0) {
+            return false;
+        }
+        data += count;
+        size -= static_cast<size_t>(count);
+    }
+    return true;
+}
+
+/**
+ * @brief Proves and verifies ACIR circuits for a stream of requests, keeping keys between them.
+ *
+ * @details Per process, the CRS is loaded once (and grown when a larger circuit arrives). Per circuit, keyed by the
+ * sha256 of its bytecode, the constraint system, circuit and proving and verification keys are kept, so a repeated
+ * circuit only pays for the proof itself. The least recently used circuits are dropped past max_cached_circuits.
+ *
+ * Requests are read and decoded (bytecode hashed, witness deserialized) on a second thread, one request ahead of the
+ * one being proven, so decoding overlaps with proving. Responses are written in request order.
+ */
+class ProverServer {
+  public:
+    ProverServer(std::string crs_path,
+                 size_t max_cached_circuits,
+                 barretenberg::srs::factories::ProverCrsConfig prover_crs_config = {})
+        : crs_path_(std::move(crs_path))
+        , max_cached_circuits_(std::max(max_cached_circuits, size_t(1)))
+        , prover_crs_config_(prover_crs_config)
+    {}
+
+    /**
+     * @brief Serve requests from in_fd until it is closed, writing responses to out_fd.
+     */
+    void serve(int in_fd, int out_fd)
+    {
+        // A client that goes away before reading its response must not take the server down with it; the failed write
+        // ends this session instead.
+        std::signal(SIGPIPE, SIG_IGN);
+
+        DecodeQueue queue;
+        std::thread reader([&]() {
+            std::vector<uint8_t> frame;
+            while (read_frame(in_fd, frame)) {
+                auto decoded = decode(frame);
+                if (!queue.push(std::move(decoded))) {
+                    break;
+                }
+            }
+            queue.close();
+        });
+        while (auto decoded = queue.pop()) {
+            auto response = handle(*decoded);
+            auto [body, body_size] = msgpack_encode_buffer(response);
+            std::vector<uint8_t> encoded(body, body + body_size);
+            aligned_free(body);
+            if (!write_frame(out_fd, encoded)) {
+                break;
+            }
+        }
+        // If we stopped first (the other end went away), this unblocks a reader waiting to hand over a request.
+        queue.close();
+        reader.join();
+    }
+
+    size_t get_num_cached_circuits() const { return circuits_.size(); }
+
+  private:
+    struct DecodedRequest {
+        ServeRequest request;
+        sha256::hash bytecode_hash;
+        acir_format::WitnessVector witness;
+        std::string error;
+    };
+
+    // Hands decoded requests from the reader to the prover, holding at most one that is not being proven yet.
+    class DecodeQueue {
+      public:
+        bool push(DecodedRequest&& decoded)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [&] { return !pending_ || closed_; });
+            if (closed_) {
+                return false;
+            }
+            pending_ = std::move(decoded);
+            cv_.notify_all();
+            return true;
+        }
+
+        std::optional<DecodedRequest> pop()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [&] { return pending_ || closed_; });
+            auto result = std::move(pending_);
+            pending_.reset();
+            cv_.notify_all();
+            return result;
+        }
+
+        void close()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+            cv_.notify_all();
+        }
+
+      private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::optional<DecodedRequest> pending_;
+        bool closed_ = false;
+    };
+
+    struct CachedCircuit {
+        acir_format::acir_format constraint_system;
+        std::unique_ptr<acir_proofs::AcirComposer> composer;
+        bool has_proving_key = false;
+        std::shared_ptr<proof_system::plonk::verification_key> verification_key;
+        uint64_t last_used = 0;
+    };
+
+    static DecodedRequest decode(std::vector<uint8_t> const& frame)
+    {
+        DecodedRequest decoded;
+        try {
+            msgpack::unpack((const char*)frame.data(), frame.size()).get().convert(decoded.request);
+            decoded.bytecode_hash = sha256::sha256(decoded.request.bytecode);
+            if (!decoded.request.witness.empty()) {
+                decoded.witness = acir_format::witness_buf_to_witness_data(decoded.request.witness);
+            }
+        } catch (std::exception const& e) {
+            decoded.error = e.what();
+        }
+        return decoded;
+    }
+
+    ServeResponse handle(DecodedRequest& decoded)
+    {
+        ServeRequest& request = decoded.request;
+        ServeResponse response;
+        response.id = request.id;
+        if (!decoded.error.empty()) {
+            response.error = "Malformed request: " + decoded.error;
+            return response;
+        }
+        try {
+            vinfo("serving ", request.command, " request ", request.id);
+            auto& circuit = get_circuit(decoded.bytecode_hash, request.bytecode);
+            auto& composer = *circuit.composer;
+            if (request.command == "gates") {
+                uint64_t gate_count = composer.get_total_circuit_size();
+                for (size_t i = 0; i < sizeof(gate_count); ++i) {
+                    response.data.push_back(static_cast<uint8_t>(gate_count >> (8 * i)));
+                }
+            } else if (request.command == "prove" || request.command == "prove_and_verify") {
+                init_proving_key(circuit);
+                response.data = composer.create_proof(circuit.constraint_system, decoded.witness, request.recursive);
+                if (request.command == "prove_and_verify") {
+                    init_verification_key(circuit);
+                    response.verified = composer.verify_proof(response.data, request.recursive);
+                    response.data.clear();
+                }
+            } else if (request.command == "verify") {
+                init_verification_key(circuit);
+                response.verified = composer.verify_proof(request.proof, request.recursive);
+            } else if (request.command == "write_vk") {
+                response.data = to_buffer(*init_verification_key(circuit));
+            } else {
+                response.error = "Unknown command: " + request.command;
+                return response;
+            }
+            response.success = true;
+        } catch (std::exception const& e) {
+            response.error = e.what();
+        }
+        return response;
+    }
+
+    CachedCircuit& get_circuit(sha256::hash const& bytecode_hash, std::vector<uint8_t> const& bytecode)
+    {
+        auto it = circuits_.find(bytecode_hash);
+        if (it == circuits_.end()) {
+            CachedCircuit circuit;
+            circuit.constraint_system = acir_format::circuit_buf_to_acir_format(bytecode);
+            circuit.composer = std::make_unique<acir_proofs::AcirComposer>(0, verbose);
+            circuit.composer->create_circuit(circuit.constraint_system);
+            // Must +1!
+            init_crs(circuit.composer->get_circuit_subgroup_size() + 1);
+            // Only evict once the new circuit has been built, so bytecode that fails to decode or build costs nothing.
+            if (circuits_.size() >= max_cached_circuits_) {
+                auto lru = std::min_element(circuits_.begin(), circuits_.end(), [](auto const& a, auto const& b) {
+                    return a.second.last_used < b.second.last_used;
+                });
+                circuits_.erase(lru);
+            }
+            it = circuits_.emplace(bytecode_hash, std::move(circuit)).first;
+        } else {
+            vinfo("using cached circuit");
+        }
+        it->second.last_used = ++use_counter_;
+        return it->second;
+    }
+
+    void init_crs(size_t num_points)
+    {
+        if (num_points <= crs_points_) {
+            return;
+        }
+        // Keys already computed keep the CRS they were computed with.
+        auto g1_data = get_g1_data(crs_path_, num_points);
+        auto g2_data = get_g2_data(crs_path_);
+        barretenberg::srs::init_crs_factory(g1_data, g2_data, prover_crs_config_, crs_path_);
+        crs_points_ = num_points;
+    }
+
+    static void init_proving_key(CachedCircuit& circuit)
+    {
+        if (!circuit.has_proving_key) {
+            circuit.composer->init_proving_key(circuit.constraint_system);
+            circuit.has_proving_key = true;
+        }
+    }
+
+    static std::shared_ptr<proof_system::plonk::verification_key> init_verification_key(CachedCircuit& circuit)
+    {
+        init_proving_key(circuit);
+        if (!circuit.verification_key) {
+            circuit.verification_key = circuit.composer->init_verification_key();
+        }
+        return circuit.verification_key;
+    }
+
+    std::string crs_path_;
+    size_t max_cached_circuits_;
+    barretenberg::srs::factories::ProverCrsConfig prover_crs_config_;
+    size_t crs_points_ = 0;
+    uint64_t use_counter_ = 0;
+    std::map<sha256::hash, CachedCircuit> circuits_;
+};
+
+/**
+ * @brief Serve requests over stdin and stdout until stdin is closed.
+ */
+inline void serve_stdio(std::string const& crs_path,
+                        size_t max_cached_circuits,
+                        barretenberg::srs::factories::ProverCrsConfig const& prover_crs_config = {})
+{
+    ProverServer server(crs_path, max_cached_circuits, prover_crs_config);
+    server.serve(STDIN_FILENO, STDOUT_FILENO);
+}
+
+/**
+ * @brief Create a unix socket at socket_path, listening for connections. The socket file gets socket_mode; with the
+ * default of 0600 only the owner of the server can connect to it.
+ */
+inline int listen_on_unix_socket(std::string const& socket_path, mode_t socket_mode = 0600)
+{
+    sockaddr_un address{};
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error("Socket path too long: " + socket_path);
+    }
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        throw std::runtime_error("Failed to create socket.");
+    }
+    ::unlink(socket_path.c_str());
+    // bind creates the socket file with whatever the umask allows. Allow nothing until the mode has been set, so that
+    // no other user can connect in between.
+    const mode_t previous_umask = ::umask(0777);
+    const bool bound = bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    ::umask(previous_umask);
+    if (!bound || ::chmod(socket_path.c_str(), socket_mode) != 0 || listen(listen_fd, 16) != 0) {
+        ::close(listen_fd);
+        throw std::runtime_error("Failed to listen on socket: " + socket_path);
+    }
+    return listen_fd;
+}
+
+/**
+ * @brief Serve requests on a unix socket at socket_path, one connection at a time. Keys are kept across connections.
+ */
+inline void serve_socket(std::string const& crs_path,
+                         std::string const& socket_path,
+                         size_t max_cached_circuits,
+                         mode_t socket_mode = 0600,
+                         barretenberg::srs::factories::ProverCrsConfig const& prover_crs_config = {})
+{
+    const int listen_fd = listen_on_unix_socket(socket_path, socket_mode);
+    vinfo("listening on: ", socket_path);
+
+    ProverServer server(crs_path, max_cached_circuits, prover_crs_config);
+    while (true) {
+        const int fd = accept(listen_fd, nullptr, nullptr);
+        if (fd < 0) {
+            continue;
+        }
+        server.serve(fd, fd);
+        ::close(fd);
+    }
+}
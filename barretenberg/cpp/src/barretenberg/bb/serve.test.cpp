@@ -0,0 +1,272 @@
+#include "serve.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+
+// Defined by main.cpp in bb itself.
+bool verbose = false;
+
+namespace {
+
+using namespace barretenberg;
+
+std::string to_hex(fr const& value)
+{
+    const uint256_t v(value);
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (size_t i = 0; i < 4; ++i) {
+        ss << std::setw(16) << v.data[3 - i];
+    }
+    return ss.str();
+}
+
+// Bytecode of a circuit with one public input w3 and the constraint w1 * w2 - w3 = 0.
+std::vector<uint8_t> product_circuit_bytecode()
+{
+    Circuit::Expression expression{
+        .mul_terms = { { to_hex(fr(1)), Circuit::Witness{ 1 }, Circuit::Witness{ 2 } } },
+        .linear_combinations = { { to_hex(-fr(1)), Circuit::Witness{ 3 } } },
+        .q_c = to_hex(fr(0)),
+    };
+    Circuit::Circuit circuit{
+        .current_witness_index = 3,
+        .opcodes = { Circuit::Opcode{ Circuit::Opcode::Arithmetic{ expression } } },
+        .private_parameters = { Circuit::Witness{ 1 }, Circuit::Witness{ 2 } },
+        .public_parameters = Circuit::PublicInputs{ { Circuit::Witness{ 3 } } },
+        .return_values = Circuit::PublicInputs{},
+        .assert_messages = {},
+    };
+    return circuit.bincodeSerialize();
+}
+
+std::vector<uint8_t> product_circuit_witness(fr const& a, fr const& b, fr const& c)
+{
+    WitnessMap::WitnessMap witness{ {
+        { WitnessMap::Witness{ 1 }, to_hex(a) },
+        { WitnessMap::Witness{ 2 }, to_hex(b) },
+        { WitnessMap::Witness{ 3 }, to_hex(c) },
+    } };
+    return witness.bincodeSerialize();
+}
+
+// Appends a coordinate as the transcript stores it: limbs of the standard form, least significant first, each big endian.
+void append_coordinate(std::vector<uint8_t>& buf, fq const& coordinate)
+{
+    const fq standard = coordinate.from_montgomery_form();
+    for (const uint64_t limb : standard.data) {
+        for (size_t i = 0; i < 8; ++i) {
+            buf.push_back(static_cast<uint8_t>(limb >> (56 - 8 * i)));
+        }
+    }
+}
+
+/**
+ * @brief Fill the CRS cache at `path` (see get_g1_data) with num_points points of an SRS for a random secret, so the
+ * server never has to download one.
+ */
+void write_test_crs(std::filesystem::path const& path, size_t num_points)
+{
+    const fr secret = fr::random_element();
+    std::vector<uint8_t> g1_data;
+    fr power = 1;
+    for (size_t i = 0; i < num_points; ++i) {
+        const g1::affine_element point(g1::one * power);
+        append_coordinate(g1_data, point.x);
+        append_coordinate(g1_data, point.y);
+        power *= secret;
+    }
+    const g2::affine_element g2_point(g2::one * secret);
+    std::vector<uint8_t> g2_data;
+    for (const fq& coordinate : { g2_point.x.c0, g2_point.x.c1, g2_point.y.c0, g2_point.y.c1 }) {
+        append_coordinate(g2_data, coordinate);
+    }
+
+    std::filesystem::create_directories(path);
+    write_file(path / "g1.dat", g1_data);
+    write_file(path / "g2.dat", g2_data);
+    std::ofstream(path / "size") << num_points;
+}
+
+ServeRequest make_request(uint64_t id, std::string command, std::vector<uint8_t> const& bytecode)
+{
+    ServeRequest request;
+    request.id = id;
+    request.command = std::move(command);
+    request.bytecode = bytecode;
+    return request;
+}
+
+std::vector<uint8_t> encode(ServeRequest const& request)
+{
+    auto [body, body_size] = msgpack_encode_buffer(request);
+    std::vector<uint8_t> encoded(body, body + body_size);
+    aligned_free(body);
+    return encoded;
+}
+
+ServeResponse decode(std::vector<uint8_t> const& frame)
+{
+    ServeResponse response;
+    msgpack::unpack((const char*)frame.data(), frame.size()).get().convert(response);
+    return response;
+}
+
+class ServeTests : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        dir = std::filesystem::temp_directory_path() /
+              ("bb_serve_test_" + std::to_string(getpid()) + "_" +
+               ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir); }
+
+    std::filesystem::path dir;
+};
+
+} // namespace
+
+TEST_F(ServeTests, Framing)
+{
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+    // Frames round trip, including empty ones and ones larger than a single socket write
+    std::vector<uint8_t> frame;
+    for (size_t size : { 0UL, 1UL, 300UL, 1UL << 20 }) {
+        std::vector<uint8_t> body(size);
+        for (size_t i = 0; i < size; ++i) {
+            body[i] = static_cast<uint8_t>(i * 7);
+        }
+        std::thread writer([&]() { EXPECT_TRUE(write_frame(fds[0], body)); });
+        EXPECT_TRUE(read_frame(fds[1], frame));
+        writer.join();
+        EXPECT_EQ(frame, body);
+    }
+
+    // A length past the limit is taken to be a corrupt stream
+    static_assert(SERVE_MAX_FRAME_SIZE + 1 == 0x40000001);
+    const std::vector<uint8_t> too_long = { 0x01, 0x00, 0x00, 0x40 };
+    ASSERT_EQ(::write(fds[0], too_long.data(), too_long.size()), 4);
+    EXPECT_FALSE(read_frame(fds[1], frame));
+
+    // As is a frame cut short by the other end closing
+    const std::vector<uint8_t> truncated = { 10, 0, 0, 0, 1, 2, 3 };
+    ASSERT_EQ(::write(fds[0], truncated.data(), truncated.size()), 7);
+    ::close(fds[0]);
+    EXPECT_FALSE(read_frame(fds[1], frame));
+    ::close(fds[1]);
+}
+
+TEST_F(ServeTests, SocketIsOwnerOnly)
+{
+    const std::string socket_path = dir / "bb.sock";
+    const int listen_fd = listen_on_unix_socket(socket_path);
+    struct stat socket_stat {};
+    ASSERT_EQ(::stat(socket_path.c_str(), &socket_stat), 0);
+    EXPECT_TRUE(S_ISSOCK(socket_stat.st_mode));
+    EXPECT_EQ(socket_stat.st_mode & 0777, 0600U);
+    ::close(listen_fd);
+
+    const int shared_fd = listen_on_unix_socket(socket_path, 0660);
+    ASSERT_EQ(::stat(socket_path.c_str(), &socket_stat), 0);
+    EXPECT_EQ(socket_stat.st_mode & 0777, 0660U);
+    ::close(shared_fd);
+}
+
+TEST_F(ServeTests, ProveAndVerifyOverSocket)
+{
+    write_test_crs(dir / "crs", 1 << 12);
+    const std::string socket_path = dir / "bb.sock";
+    const int listen_fd = listen_on_unix_socket(socket_path);
+
+    ProverServer server(dir / "crs", 4);
+    std::thread server_thread([&]() {
+        const int fd = accept(listen_fd, nullptr, nullptr);
+        ASSERT_GE(fd, 0);
+        server.serve(fd, fd);
+        ::close(fd);
+    });
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    ASSERT_EQ(connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+
+    const auto bytecode = product_circuit_bytecode();
+    const fr a = fr::random_element();
+    const fr b = fr::random_element();
+    std::vector<uint8_t> frame;
+
+    // Garbage gets an error response, and the connection stays usable
+    EXPECT_TRUE(write_frame(fd, { 0xc1, 0xc1 }));
+    ASSERT_TRUE(read_frame(fd, frame));
+    auto response = decode(frame);
+    EXPECT_FALSE(response.success);
+    EXPECT_TRUE(response.error.starts_with("Malformed request"));
+
+    auto prove_request = make_request(1, "prove", bytecode);
+    prove_request.witness = product_circuit_witness(a, b, a * b);
+    EXPECT_TRUE(write_frame(fd, encode(prove_request)));
+    ASSERT_TRUE(read_frame(fd, frame));
+    response = decode(frame);
+    ASSERT_TRUE(response.success) << response.error;
+    EXPECT_EQ(response.id, 1U);
+    const auto proof = response.data;
+    EXPECT_FALSE(proof.empty());
+
+    // Two requests in flight at once: the second is decoded while the first is handled, and responses come in order
+    auto tampered_proof = proof;
+    tampered_proof[tampered_proof.size() / 2] ^= 1;
+    auto verify_request = make_request(2, "verify", bytecode);
+    verify_request.proof = proof;
+    auto tampered_verify_request = make_request(3, "verify", bytecode);
+    tampered_verify_request.proof = tampered_proof;
+    EXPECT_TRUE(write_frame(fd, encode(verify_request)));
+    EXPECT_TRUE(write_frame(fd, encode(tampered_verify_request)));
+    ASSERT_TRUE(read_frame(fd, frame));
+    response = decode(frame);
+    EXPECT_EQ(response.id, 2U);
+    EXPECT_TRUE(response.success) << response.error;
+    EXPECT_TRUE(response.verified);
+    ASSERT_TRUE(read_frame(fd, frame));
+    response = decode(frame);
+    EXPECT_EQ(response.id, 3U);
+    EXPECT_FALSE(response.verified);
+
+    ::close(fd);
+    server_thread.join();
+    ::close(listen_fd);
+}
+
+TEST_F(ServeTests, BadCircuitDoesNotEvict)
+{
+    write_test_crs(dir / "crs", 1 << 12);
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    ProverServer server(dir / "crs", 1);
+    std::thread server_thread([&]() { server.serve(fds[1], fds[1]); });
+
+    std::vector<uint8_t> frame;
+    EXPECT_TRUE(write_frame(fds[0], encode(make_request(1, "gates", product_circuit_bytecode()))));
+    ASSERT_TRUE(read_frame(fds[0], frame));
+    EXPECT_TRUE(decode(frame).success);
+
+    // Bytecode that does not decode fails its request, and must not cost the cache its one circuit.
+    EXPECT_TRUE(write_frame(fds[0], encode(make_request(2, "gates", { 0xff, 0xff, 0xff }))));
+    ASSERT_TRUE(read_frame(fds[0], frame));
+    EXPECT_FALSE(decode(frame).success);
+
+    ::close(fds[0]);
+    server_thread.join();
+    ::close(fds[1]);
+    EXPECT_EQ(server.get_num_cached_circuits(), 1UL);
+}
@@ -10,7 +10,9 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -20,6 +22,7 @@
 #include <cstddef>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace proof_system::honk::pcs {
 
@@ -60,17 +63,64 @@ template <class Curve> class CommitmentKey {
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
+     * @details If the SRS comes with a fixed-base table, the commitment is computed from the table (lookups and
+     * additions only) whatever the algorithm.
+     *
      * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
+     * @param algorithm the MSM engine to use, see signed_digit_msm.hpp
      * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
      */
-    Commitment commit(std::span<const Fr> polynomial)
+    Commitment commit(std::span<const Fr> polynomial,
+                      barretenberg::scalar_multiplication::MsmAlgorithm algorithm =
+                          barretenberg::scalar_multiplication::MsmAlgorithm::PIPPENGER)
     {
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
+        if (auto fixed_base_table = srs->get_fixed_base_table()) {
+            return fixed_base_table->msm(polynomial);
+        }
+        if (algorithm == barretenberg::scalar_multiplication::MsmAlgorithm::SIGNED_DIGIT) {
+            return barretenberg::scalar_multiplication::pippenger_signed_digit_unsafe<Curve>(
+                polynomial.data(), srs->get_monomial_points(), degree);
+        }
         return barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
             const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
     };
 
+    /**
+     * @brief Commit to several polynomials at once
+     *
+     * @details Cheaper than calling commit on each polynomial in turn: the polynomials share one bucket sort and one
+     * set of batched inversions per window, and each SRS point is read once for all of them. In WASM this falls back
+     * to one pippenger per polynomial.
+     *
+     * @param polynomials univariate polynomials p_j(X), not necessarily of the same size
+     * @return the commitments [p_j(x)], in the same order
+     */
+    std::vector<Commitment> batch_commit(std::span<const std::span<const Fr>> polynomials)
+    {
+        for ([[maybe_unused]] const auto& polynomial : polynomials) {
+            ASSERT(polynomial.size() <= srs->get_monomial_size());
+        }
+        if (auto fixed_base_table = srs->get_fixed_base_table()) {
+            auto results = fixed_base_table->batch_msm(polynomials);
+            return { results.begin(), results.end() };
+        }
+#ifdef __wasm__
+        // The batched MSM can hold up to 256MB of buckets, too much for a WASM heap.
+        std::vector<Commitment> commitments;
+        commitments.reserve(polynomials.size());
+        for (const auto& polynomial : polynomials) {
+            commitments.emplace_back(commit(polynomial));
+        }
+        return commitments;
+#else
+        auto results = barretenberg::scalar_multiplication::pippenger_signed_digit_batch_unsafe<Curve>(
+            polynomials, srs->get_monomial_points());
+        return { results.begin(), results.end() };
+#endif
+    };
+
     barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> srs;
 };
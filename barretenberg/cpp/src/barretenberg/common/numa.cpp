@@ -0,0 +1,213 @@
+#include "numa.hpp"
+#include "log.hpp"
+#include "thread.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#if defined(__linux__) && !defined(__wasm__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define BB_NUMA_SUPPORTED 1
+#endif
+
+namespace barretenberg::numa {
+
+namespace {
+
+AffinityMode parse_affinity(const char* value)
+{
+    if (value == nullptr || std::strcmp(value, "none") == 0) {
+        return AffinityMode::NONE;
+    }
+    if (std::strcmp(value, "compact") == 0) {
+        return AffinityMode::COMPACT;
+    }
+    if (std::strcmp(value, "spread") == 0) {
+        return AffinityMode::SPREAD;
+    }
+    info("Unknown BB_THREAD_AFFINITY value ", value, ", ignoring.");
+    return AffinityMode::NONE;
+}
+
+MemoryPolicy parse_memory_policy(const char* value)
+{
+    if (value == nullptr || std::strcmp(value, "none") == 0) {
+        return MemoryPolicy::NONE;
+    }
+    if (std::strcmp(value, "first_touch") == 0) {
+        return MemoryPolicy::FIRST_TOUCH;
+    }
+    if (std::strcmp(value, "interleave") == 0) {
+        return MemoryPolicy::INTERLEAVE;
+    }
+    info("Unknown BB_NUMA_MEMORY value ", value, ", ignoring.");
+    return MemoryPolicy::NONE;
+}
+
+// Pool workers read the configuration while set_config may be writing it, so each field is an atomic.
+struct AtomicConfig {
+    std::atomic<AffinityMode> affinity;
+    std::atomic<MemoryPolicy> memory;
+};
+
+AtomicConfig& global_config()
+{
+    static AtomicConfig config{ parse_affinity(std::getenv("BB_THREAD_AFFINITY")),
+                                parse_memory_policy(std::getenv("BB_NUMA_MEMORY")) };
+    return config;
+}
+
+/**
+ * The order in which slots are assigned to cpus. COMPACT walks the nodes one after another, SPREAD takes one cpu from
+ * each node in turn.
+ */
+std::vector<size_t> get_cpu_order(AffinityMode mode)
+{
+    const auto& nodes = get_node_cpus();
+    std::vector<size_t> order;
+    if (mode == AffinityMode::COMPACT) {
+        for (const auto& node : nodes) {
+            order.insert(order.end(), node.begin(), node.end());
+        }
+        return order;
+    }
+    size_t max_node_size = 0;
+    for (const auto& node : nodes) {
+        max_node_size = std::max(max_node_size, node.size());
+    }
+    for (size_t i = 0; i < max_node_size; ++i) {
+        for (const auto& node : nodes) {
+            if (i < node.size()) {
+                order.push_back(node[i]);
+            }
+        }
+    }
+    return order;
+}
+
+} // namespace
+
+Config get_config()
+{
+    const auto& config = global_config();
+    return { config.affinity.load(std::memory_order_relaxed), config.memory.load(std::memory_order_relaxed) };
+}
+
+void set_config(const Config& config)
+{
+    global_config().affinity.store(config.affinity, std::memory_order_relaxed);
+    global_config().memory.store(config.memory, std::memory_order_relaxed);
+}
+
+std::vector<size_t> parse_cpu_list(const std::string& cpu_list)
+{
+    std::vector<size_t> cpus;
+    std::stringstream stream(cpu_list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        size_t dash = range.find('-');
+        size_t first = std::stoul(range.substr(0, dash));
+        size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+        for (size_t cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+const std::vector<std::vector<size_t>>& get_node_cpus()
+{
+    static const std::vector<std::vector<size_t>> node_cpus = []() {
+        std::vector<std::vector<size_t>> nodes;
+#ifdef BB_NUMA_SUPPORTED
+        for (size_t node = 0;; ++node) {
+            std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            if (!file.good()) {
+                break;
+            }
+            std::string cpu_list;
+            std::getline(file, cpu_list);
+            auto cpus = parse_cpu_list(cpu_list);
+            if (!cpus.empty()) {
+                nodes.push_back(cpus);
+            }
+        }
+#endif
+        if (nodes.empty()) {
+            std::vector<size_t> cpus(get_num_cpus());
+            for (size_t i = 0; i < cpus.size(); ++i) {
+                cpus[i] = i;
+            }
+            nodes.push_back(cpus);
+        }
+        return nodes;
+    }();
+    return node_cpus;
+}
+
+void pin_current_thread([[maybe_unused]] size_t slot)
+{
+#ifdef BB_NUMA_SUPPORTED
+    const AffinityMode mode = get_config().affinity;
+    if (mode == AffinityMode::NONE) {
+        return;
+    }
+    static const std::vector<size_t> cpu_order = get_cpu_order(mode);
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu_order[slot % cpu_order.size()], &cpu_set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+        info("Failed to pin thread to cpu ", cpu_order[slot % cpu_order.size()]);
+    }
+#endif
+}
+
+void place_memory([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size)
+{
+#ifdef BB_NUMA_SUPPORTED
+    const MemoryPolicy policy = get_config().memory;
+    if (policy == MemoryPolicy::NONE || ptr == nullptr || size < MIN_PLACEMENT_SIZE) {
+        return;
+    }
+    if (policy == MemoryPolicy::FIRST_TOUCH) {
+        // Many more chunks than threads, so that whichever thread grabs a chunk places its pages locally and the
+        // buffer ends up split between nodes in proportion to the threads running on them.
+        const size_t chunk_size = MIN_PLACEMENT_SIZE / 4;
+        const size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+        auto* bytes = static_cast<uint8_t*>(ptr);
+        parallel_for(num_chunks, [&](size_t i) {
+            const size_t start = i * chunk_size;
+            memset(bytes + start, 0, std::min(chunk_size, size - start));
+        });
+        return;
+    }
+    // MPOL_INTERLEAVE from <linux/mempolicy.h>. mbind only accepts page aligned ranges, so shrink to whole pages.
+    constexpr int MPOL_INTERLEAVE_MODE = 3;
+    const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + page_size - 1) & ~(page_size - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(page_size - 1);
+    const size_t num_nodes = get_node_cpus().size();
+    if (end <= begin || num_nodes < 2) {
+        return;
+    }
+    std::vector<unsigned long> node_mask((num_nodes + 63) / 64, 0);
+    for (size_t node = 0; node < num_nodes; ++node) {
+        node_mask[node / 64] |= 1UL << (node % 64);
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    if (syscall(SYS_mbind, begin, end - begin, MPOL_INTERLEAVE_MODE, node_mask.data(), num_nodes + 1, 0) != 0) {
+        info("mbind(MPOL_INTERLEAVE) failed, leaving memory placement to the kernel.");
+    }
+#endif
+}
+
+} // namespace barretenberg::numa
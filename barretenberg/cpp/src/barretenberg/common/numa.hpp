@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Thread placement and memory placement for multi-socket machines.
+ *
+ * By default nothing here changes behaviour: threads float and memory lands on whichever node first touches it, which
+ * for a buffer zeroed by one thread means one node. On dual-socket provers that leaves half the threads reading remote
+ * memory. Configure with the environment (read once, on first use) or with `set_config` before the first parallel_for:
+ *
+ *   BB_THREAD_AFFINITY=none|compact|spread
+ *     compact: pool worker i is pinned to cpu i + 1 in node order, filling one node before moving to the next.
+ *     spread:  pool workers are pinned round-robin across nodes, so any prefix of the pool spans every socket.
+ *     In both modes the first cpu is left to the thread calling parallel_for, which is not pinned since it belongs to
+ *     the application.
+ *   BB_NUMA_MEMORY=none|first_touch|interleave
+ *     first_touch: large slabs are zeroed by the whole thread pool, so their pages are spread over the nodes the
+ *                  workers run on (combine with BB_THREAD_AFFINITY=spread). This is best effort: it relies on the
+ *                  allocator returning pages nobody has touched yet, which glibc does for allocations it serves with
+ *                  mmap (those above M_MMAP_THRESHOLD). Memory recycled from the heap keeps its existing placement.
+ *     interleave:  large slabs are bound page-by-page round-robin across all nodes with mbind(MPOL_INTERLEAVE).
+ *
+ * Only Linux is supported. Elsewhere (and in WASM) every function here is a no-op.
+ */
+namespace barretenberg::numa {
+
+enum class AffinityMode { NONE, COMPACT, SPREAD };
+enum class MemoryPolicy { NONE, FIRST_TOUCH, INTERLEAVE };
+
+struct Config {
+    AffinityMode affinity = AffinityMode::NONE;
+    MemoryPolicy memory = MemoryPolicy::NONE;
+};
+
+// Allocations smaller than this are left alone, they are not worth a parallel_for or a syscall.
+constexpr size_t MIN_PLACEMENT_SIZE = static_cast<size_t>(2) * 1024 * 1024;
+
+Config get_config();
+
+/**
+ * @brief Override the configuration read from the environment.
+ * @details Safe to call while other threads are running. Thread affinity is applied when the pool workers start, so it
+ * must be set before the first parallel_for. The memory policy applies to every allocation made after the call.
+ */
+void set_config(const Config& config);
+
+/**
+ * @brief Parse a kernel cpu list such as "0-3,8,10-11" into {0,1,2,3,8,10,11}.
+ */
+std::vector<size_t> parse_cpu_list(const std::string& cpu_list);
+
+/**
+ * @brief The cpus of each NUMA node, from /sys/devices/system/node. A machine without that information is reported as
+ * a single node holding cpus [0, get_num_cpus()).
+ */
+const std::vector<std::vector<size_t>>& get_node_cpus();
+
+/**
+ * @brief Pin the calling thread according to the affinity mode. Pool worker i uses slot i + 1. Slot 0 is never
+ * assigned: its cpu is left free for the thread that calls parallel_for, which the pool does not pin.
+ */
+void pin_current_thread(size_t slot);
+
+/**
+ * @brief Apply the memory policy to a freshly allocated buffer that has not been written to yet.
+ * @details With FIRST_TOUCH the buffer is zeroed as a side effect. Pages that were already touched before the call
+ * (e.g. heap memory the allocator reused) stay where they are.
+ */
+void place_memory(void* ptr, size_t size);
+
+} // namespace barretenberg::numa
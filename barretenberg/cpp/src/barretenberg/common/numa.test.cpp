@@ -0,0 +1,124 @@
+#include "numa.hpp"
+#include "mem.hpp"
+#include "slab_allocator.hpp"
+#include <cstring>
+#include <gtest/gtest.h>
+#include <set>
+#include <thread>
+
+#if defined(__linux__) && !defined(__wasm__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace barretenberg::test_numa {
+
+TEST(Numa, ParseCpuList)
+{
+    EXPECT_EQ(numa::parse_cpu_list("0-3,8,10-11\n"), (std::vector<size_t>{ 0, 1, 2, 3, 8, 10, 11 }));
+    EXPECT_EQ(numa::parse_cpu_list("5"), (std::vector<size_t>{ 5 }));
+    EXPECT_TRUE(numa::parse_cpu_list("").empty());
+}
+
+TEST(Numa, NodeCpusCoverAtLeastOneCpu)
+{
+    const auto& nodes = numa::get_node_cpus();
+    ASSERT_FALSE(nodes.empty());
+    EXPECT_FALSE(nodes[0].empty());
+}
+
+TEST(Numa, PlacementPoliciesPreserveSlabs)
+{
+    const auto original = numa::get_config();
+    constexpr size_t size = numa::MIN_PLACEMENT_SIZE * 3 + 96;
+
+    for (auto policy : { numa::MemoryPolicy::FIRST_TOUCH, numa::MemoryPolicy::INTERLEAVE }) {
+        numa::set_config({ numa::AffinityMode::NONE, policy });
+        auto slab = get_mem_slab(size);
+        auto* bytes = static_cast<uint8_t*>(slab.get());
+        if (policy == numa::MemoryPolicy::FIRST_TOUCH) {
+            for (size_t i = 0; i < size; i += 4096) {
+                EXPECT_EQ(bytes[i], 0);
+            }
+        }
+        memset(bytes, 0xab, size);
+        EXPECT_EQ(bytes[size - 1], 0xab);
+    }
+    numa::set_config(original);
+}
+
+#if defined(__linux__) && !defined(__wasm__)
+TEST(Numa, PinningSetsTheAffinityMask)
+{
+    // A cpu outside our cpuset (e.g. in a container) cannot be pinned to.
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+    for (const auto& node : numa::get_node_cpus()) {
+        for (size_t cpu : node) {
+            if (!CPU_ISSET(cpu, &allowed)) {
+                GTEST_SKIP() << "cpu " << cpu << " is not in this process's cpuset";
+            }
+        }
+    }
+
+    const auto original = numa::get_config();
+    numa::set_config({ numa::AffinityMode::COMPACT, original.memory });
+    cpu_set_t pinned;
+    CPU_ZERO(&pinned);
+    std::thread([&]() {
+        numa::pin_current_thread(1);
+        pthread_getaffinity_np(pthread_self(), sizeof(pinned), &pinned);
+    }).join();
+    numa::set_config(original);
+
+    ASSERT_EQ(CPU_COUNT(&pinned), 1);
+    bool on_a_node_cpu = false;
+    for (const auto& node : numa::get_node_cpus()) {
+        for (size_t cpu : node) {
+            on_a_node_cpu = on_a_node_cpu || CPU_ISSET(cpu, &pinned);
+        }
+    }
+    EXPECT_TRUE(on_a_node_cpu);
+}
+
+TEST(Numa, InterleavedSlabSpansNodes)
+{
+    if (numa::get_node_cpus().size() < 2) {
+        GTEST_SKIP() << "interleaving needs more than one NUMA node";
+    }
+    constexpr int MPOL_INTERLEAVE_MODE = 3;
+    constexpr unsigned long MPOL_F_NODE = 1;
+    constexpr unsigned long MPOL_F_ADDR = 2;
+
+    const auto original = numa::get_config();
+    numa::set_config({ original.affinity, numa::MemoryPolicy::INTERLEAVE });
+    constexpr size_t size = numa::MIN_PLACEMENT_SIZE * 4;
+    auto slab = get_mem_slab(size);
+    numa::set_config(original);
+
+    auto* bytes = static_cast<uint8_t*>(slab.get());
+    memset(bytes, 1, size);
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    // Skip the first and last page, which mbind leaves alone when the slab is not page aligned.
+    uint8_t* first_page = bytes + page_size - (reinterpret_cast<uintptr_t>(bytes) % page_size);
+
+    int mode = -1;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    ASSERT_EQ(syscall(SYS_get_mempolicy, &mode, nullptr, 0, first_page, MPOL_F_ADDR), 0);
+    EXPECT_EQ(mode, MPOL_INTERLEAVE_MODE);
+
+    std::set<int> nodes;
+    for (uint8_t* page = first_page; page + page_size <= bytes + size; page += page_size) {
+        int node = -1;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+        ASSERT_EQ(syscall(SYS_get_mempolicy, &node, nullptr, 0, page, MPOL_F_NODE | MPOL_F_ADDR), 0);
+        nodes.insert(node);
+    }
+    EXPECT_GT(nodes.size(), 1UL);
+}
+#endif
+
+} // namespace barretenberg::test_numa
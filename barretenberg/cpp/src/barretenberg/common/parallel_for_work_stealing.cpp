@@ -0,0 +1,273 @@
+#include "numa.hpp"
+#include "thread.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace {
+
+/**
+ * A single parallel_for invocation. Lives on the stack of the thread that called parallel_for.
+ * "Helper" tasks pushed into the pool all point at the job, and each one that runs drains iterations from the shared
+ * counter. The owner does not return until every helper it pushed has run, so the job outlives all references to it.
+ */
+struct Job {
+    const std::function<void(size_t)>* func;
+    size_t num_iterations;
+    std::atomic<size_t> next_iteration = 0;
+    std::atomic<size_t> pending_helpers = 0;
+
+    void run_iterations()
+    {
+        size_t iteration = 0;
+        while ((iteration = next_iteration.fetch_add(1, std::memory_order_relaxed)) < num_iterations) {
+            (*func)(iteration);
+        }
+    }
+};
+
+/**
+ * A deque of helper tasks owned by one thread. The owner pushes and pops at the back (LIFO, so nested jobs are
+ * finished before outer ones and stay hot in cache), thieves take from the front (FIFO, so they get the oldest, and
+ * usually largest, outstanding work).
+ */
+class TaskDeque {
+  public:
+    void push(Job* job)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        tasks_.push_back(job);
+    }
+
+    Job* pop()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return nullptr;
+        }
+        Job* job = tasks_.back();
+        tasks_.pop_back();
+        return job;
+    }
+
+    Job* steal()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return nullptr;
+        }
+        Job* job = tasks_.front();
+        tasks_.pop_front();
+        return job;
+    }
+
+  private:
+    std::mutex mutex_;
+    std::deque<Job*> tasks_;
+};
+
+constexpr size_t NOT_A_WORKER = static_cast<size_t>(-1);
+
+// Index of the pool worker running on this thread, or NOT_A_WORKER for external threads (e.g. the main thread).
+thread_local size_t tl_worker_index = NOT_A_WORKER;
+
+class WorkStealingPool {
+  public:
+    WorkStealingPool(size_t num_threads);
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    void run(size_t num_iterations, const std::function<void(size_t)>& func, TaskPriority priority)
+    {
+        Job job{ &func, num_iterations };
+
+        // The calling thread always takes part, so we only need helpers for the remaining iterations.
+        size_t num_helpers = std::min(workers.size(), num_iterations - 1);
+        job.pending_helpers = num_helpers;
+        for (size_t i = 0; i < num_helpers; ++i) {
+            push(&job, priority);
+        }
+        if (num_helpers > 0) {
+            wake(num_helpers);
+        }
+
+        job.run_iterations();
+
+        // Help out with whatever work is available until our helpers have all run. This is what makes nested
+        // parallel_for calls safe: a worker waiting on an inner loop keeps executing tasks, including the helpers of
+        // its own job that nobody else has picked up yet. Only once there is nothing left to run do we block, until
+        // either our last helper finishes or new work is queued.
+        while (job.pending_helpers.load(std::memory_order_acquire) != 0) {
+            if (Job* task = find_task(); task != nullptr) {
+                run_helper(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            owner_condition.wait(lock, [this, &job] {
+                return job.pending_helpers.load(std::memory_order_acquire) == 0 ||
+                       num_queued_tasks.load(std::memory_order_acquire) != 0;
+            });
+        }
+    }
+
+  private:
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<TaskDeque>> local_queues;
+    // Tasks submitted from threads outside the pool, and tasks submitted with high priority from anywhere.
+    TaskDeque injection_queue;
+    TaskDeque high_priority_queue;
+    std::atomic<size_t> num_queued_tasks = 0;
+    std::mutex sleep_mutex;
+    // Idle workers wait on `condition`; threads blocked in run() waiting for their helpers wait on `owner_condition`.
+    std::condition_variable condition;
+    std::condition_variable owner_condition;
+    bool stop = false;
+
+    BBERG_NO_PROFILE void worker_loop(size_t thread_index);
+
+    void push(Job* job, TaskPriority priority)
+    {
+        // Count the task before publishing it, so a thief can never decrement the counter below zero.
+        num_queued_tasks.fetch_add(1, std::memory_order_release);
+        if (priority == TaskPriority::HIGH) {
+            high_priority_queue.push(job);
+        } else if (tl_worker_index != NOT_A_WORKER) {
+            local_queues[tl_worker_index]->push(job);
+        } else {
+            injection_queue.push(job);
+        }
+    }
+
+    void wake(size_t num_tasks)
+    {
+        {
+            // Taking the lock orders this against a thread that has checked num_queued_tasks but not yet slept.
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+        }
+        if (num_tasks >= workers.size()) {
+            condition.notify_all();
+        } else {
+            for (size_t i = 0; i < num_tasks; ++i) {
+                condition.notify_one();
+            }
+        }
+        // Blocked owners can run the new tasks too.
+        owner_condition.notify_all();
+    }
+
+    void run_helper(Job* job)
+    {
+        job->run_iterations();
+        // The owner may return (destroying the job) as soon as the count hits zero, so the job must not be touched
+        // after the decrement.
+        if (job->pending_helpers.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            {
+                std::unique_lock<std::mutex> lock(sleep_mutex);
+            }
+            owner_condition.notify_all();
+        }
+    }
+
+    /**
+     * Look for a task in priority order: high priority work, our own deque, externally submitted work, then steal
+     * from the other workers starting at our neighbour so that thieves spread out.
+     */
+    Job* find_task()
+    {
+        Job* job = high_priority_queue.steal();
+        if (job == nullptr && tl_worker_index != NOT_A_WORKER) {
+            job = local_queues[tl_worker_index]->pop();
+        }
+        if (job == nullptr) {
+            job = injection_queue.steal();
+        }
+        const size_t num_queues = local_queues.size();
+        const size_t start = tl_worker_index == NOT_A_WORKER ? 0 : tl_worker_index + 1;
+        for (size_t i = 0; job == nullptr && i < num_queues; ++i) {
+            size_t victim = (start + i) % num_queues;
+            if (victim != tl_worker_index) {
+                job = local_queues[victim]->steal();
+            }
+        }
+        if (job != nullptr) {
+            num_queued_tasks.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+};
+
+WorkStealingPool::WorkStealingPool(size_t num_threads)
+{
+    local_queues.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        local_queues.emplace_back(std::make_unique<TaskDeque>());
+    }
+    workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::worker_loop(size_t thread_index)
+{
+    tl_worker_index = thread_index;
+    // Slot 0 is left free for the thread that calls parallel_for, see numa::pin_current_thread.
+    barretenberg::numa::pin_current_thread(thread_index + 1);
+    while (true) {
+        if (Job* job = find_task(); job != nullptr) {
+            run_helper(job);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        // Tasks are counted before they are published and wake() takes sleep_mutex before notifying, so a task queued
+        // after we checked the count cannot be missed.
+        condition.wait(lock, [this] { return num_queued_tasks.load(std::memory_order_acquire) != 0 || stop; });
+        if (stop) {
+            break;
+        }
+    }
+}
+} // namespace
+
+/**
+ * A work-stealing strategy. Every worker owns a deque of tasks, and idle workers steal from the others. The thread
+ * calling parallel_for executes iterations itself and, while waiting for stragglers, runs other queued tasks, only
+ * blocking once there is nothing left to run. This means parallel_for can be nested (e.g. an MSM inside a parallel
+ * loop over prover rounds) without serialising or oversubscribing the machine: inner loops share the same fixed set
+ * of threads.
+ * HIGH priority loops are placed on a shared queue that every thread checks before its own work.
+ */
+void parallel_for_work_stealing(size_t num_iterations,
+                                const std::function<void(size_t)>& func,
+                                TaskPriority priority)
+{
+    static WorkStealingPool pool(get_num_cpus() - 1);
+
+    if (num_iterations == 0) {
+        return;
+    }
+    pool.run(num_iterations, func, priority);
+}
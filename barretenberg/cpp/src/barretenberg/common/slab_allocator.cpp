@@ -2,6 +2,7 @@
 #include <barretenberg/common/assert.hpp>
 #include <barretenberg/common/log.hpp>
 #include <barretenberg/common/mem.hpp>
+#include <barretenberg/common/numa.hpp>
 #include <cstddef>
 #include <numeric>
 #include <unordered_map>
@@ -127,7 +128,9 @@ void SlabAllocator::init(size_t circuit_size_hint)
     for (auto& e : prealloc_num) {
         for (size_t i = 0; i < e.second; ++i) {
             auto size = e.first;
-            memory_store[size].push_back(aligned_alloc(32, size));
+            void* slab = aligned_alloc(64, size);
+            barretenberg::numa::place_memory(slab, size);
+            memory_store[size].push_back(slab);
             dbg_info("Allocated memory slab of size: ", size, " total: ", get_total_size());
         }
     }
@@ -171,11 +174,17 @@ std::shared_ptr<void> SlabAllocator::get(size_t req_size)
                 } };
     }
 
+#ifndef NO_MULTITHREADING
+    // Placing memory may run a parallel_for, whose tasks are free to allocate slabs themselves.
+    lock.unlock();
+#endif
     if (req_size > static_cast<size_t>(1024 * 1024)) {
         dbg_info("WARNING: Allocating unmanaged memory slab of size: ", req_size);
     }
     if (req_size % 32 == 0) {
-        return { aligned_alloc(32, req_size), aligned_free };
+        void* slab = aligned_alloc(64, req_size);
+        barretenberg::numa::place_memory(slab, req_size);
+        return { slab, aligned_free };
     }
     // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
     return { malloc(req_size), free };
@@ -28,7 +28,8 @@ namespace barretenberg {
 void init_slab_allocator(size_t circuit_subgroup_size);
 
 /**
- * Returns a slab from the preallocated pool of slabs, or fallback to a new heap allocation (32 byte aligned).
+ * Returns a slab from the preallocated pool of slabs, or fallback to a new heap allocation (64 byte aligned, so
+ * cache-line aligned types such as affine elements can live in a slab).
  * Ref counted result so no need to manually free.
  */
 std::shared_ptr<void> get_mem_slab(size_t size);
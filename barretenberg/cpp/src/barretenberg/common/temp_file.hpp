@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+
+/**
+ * @brief A file name next to `filename`, to write a new version of it under before renaming it into place.
+ *
+ * @details Each call returns a different name, so writers in other threads or processes never write to the same
+ * temporary file. Otherwise one writer could rename the other's partial file into place, or truncate it in between.
+ */
+inline std::string unique_temp_filename(std::string const& filename)
+{
+    thread_local std::mt19937_64 engine(std::random_device{}());
+    std::ostringstream name;
+    name << filename << ".tmp." << std::hex << engine();
+    return name.str();
+}
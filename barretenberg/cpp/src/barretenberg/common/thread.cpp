@@ -34,6 +34,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the pools above have a single global job slot, so a parallel_for issued from inside another
+ * parallel_for either corrupts it or (with spawning) oversubscribes the cores. "work_stealing" gives each thread its
+ * own deque and lets a waiting thread execute queued work, so loops can nest freely and share one set of threads.
+ * Defaulting to work_stealing.
  */
 
 // 64 core aws r5.
@@ -68,7 +73,13 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
-void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
+void parallel_for_work_stealing(size_t num_iterations,
+                                const std::function<void(size_t)>& func,
+                                TaskPriority priority);
+
+void parallel_for(size_t num_iterations,
+                  const std::function<void(size_t)>& func,
+                  [[maybe_unused]] TaskPriority priority)
 {
 #ifdef NO_MULTITHREADING
     for (size_t i = 0; i < num_iterations; ++i) {
@@ -81,8 +92,9 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func, priority);
 #endif
 #endif
 }
\ No newline at end of file
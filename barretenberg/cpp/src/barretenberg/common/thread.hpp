@@ -1,10 +1,12 @@
 #pragma once
+#include <algorithm>
 #include <atomic>
 #include <barretenberg/env/hardware_concurrency.hpp>
 #include <barretenberg/numeric/bitop/get_msb.hpp>
 #include <functional>
 #include <iostream>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 inline size_t get_num_cpus()
@@ -22,4 +24,48 @@ inline size_t get_num_cpus_pow2()
     return static_cast<size_t>(1ULL << numeric::get_msb(get_num_cpus()));
 }
 
-void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+/**
+ * @brief Scheduling hint for parallel_for. HIGH priority loops are picked up by idle threads before any NORMAL work.
+ * @details Only honoured by the work-stealing backend, the other backends run every loop immediately.
+ */
+enum class TaskPriority { NORMAL, HIGH };
+
+void parallel_for(size_t num_iterations,
+                  const std::function<void(size_t)>& func,
+                  TaskPriority priority = TaskPriority::NORMAL);
+
+/**
+ * @brief Map each index in [0, num_iterations) with `func` and combine the results with `reduce`.
+ * @details The range is divided into one contiguous chunk per cpu. Each chunk is folded left-to-right starting from
+ * `identity`, and the chunk results are then combined in chunk order, so for an associative `reduce` the result does
+ * not depend on the number of threads. May be nested inside other parallel_for/parallel_reduce calls.
+ *
+ * @param num_iterations
+ * @param identity The identity element of `reduce`
+ * @param func Maps an index to a value of type T
+ * @param reduce Associative binary operation on T
+ * @return T
+ */
+template <typename T, typename Func, typename Reduce>
+T parallel_reduce(size_t num_iterations, const T& identity, const Func& func, const Reduce& reduce)
+{
+    const size_t num_chunks = std::max(std::min(num_iterations, get_num_cpus()), static_cast<size_t>(1));
+    const size_t chunk_size = (num_iterations + num_chunks - 1) / num_chunks;
+    // Each chunk writes its own slot concurrently, which std::vector<bool> cannot allow as it packs slots into bits
+    using Partial = std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>;
+    std::vector<Partial> partial_results(num_chunks, identity);
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = chunk * chunk_size;
+        const size_t end = std::min(start + chunk_size, num_iterations);
+        T accumulator = identity;
+        for (size_t i = start; i < end; ++i) {
+            accumulator = reduce(accumulator, func(i));
+        }
+        partial_results[chunk] = accumulator;
+    });
+    T result = static_cast<T>(partial_results[0]);
+    for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+        result = reduce(result, static_cast<T>(partial_results[chunk]));
+    }
+    return result;
+}
@@ -0,0 +1,101 @@
+#include "thread.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace barretenberg::test_thread {
+
+TEST(Thread, ParallelForVisitsEveryIterationOnce)
+{
+    constexpr size_t num_iterations = 1 << 12;
+    std::vector<std::atomic<size_t>> counts(num_iterations);
+
+    parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 1UL);
+    }
+}
+
+TEST(Thread, ParallelForZeroIterations)
+{
+    bool called = false;
+    parallel_for(0, [&](size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST(Thread, NestedParallelFor)
+{
+    constexpr size_t outer = 16;
+    constexpr size_t inner = 256;
+    std::vector<std::atomic<size_t>> counts(outer * inner);
+
+    parallel_for(outer, [&](size_t i) {
+        parallel_for(inner, [&](size_t j) {
+            // A third level, to make sure waiting threads keep helping rather than deadlocking.
+            parallel_for(2, [&](size_t k) {
+                if (k == 0) {
+                    counts[i * inner + j]++;
+                }
+            });
+        });
+    });
+
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 1UL);
+    }
+}
+
+TEST(Thread, HighPriorityParallelFor)
+{
+    constexpr size_t num_iterations = 1024;
+    std::atomic<size_t> total = 0;
+
+    parallel_for(num_iterations, [&](size_t i) { total += i; }, TaskPriority::HIGH);
+
+    EXPECT_EQ(total, num_iterations * (num_iterations - 1) / 2);
+}
+
+TEST(Thread, ParallelReduce)
+{
+    constexpr size_t num_iterations = 100003;
+    std::vector<uint64_t> values(num_iterations);
+    std::iota(values.begin(), values.end(), 1);
+
+    auto sum = parallel_reduce(
+        num_iterations, uint64_t(0), [&](size_t i) { return values[i]; }, std::plus<uint64_t>());
+    EXPECT_EQ(sum, std::accumulate(values.begin(), values.end(), uint64_t(0)));
+
+    auto empty = parallel_reduce(
+        0, uint64_t(7), [&](size_t i) { return values[i]; }, std::plus<uint64_t>());
+    EXPECT_EQ(empty, 7UL);
+
+    // Chunk results of a bool reduction are written concurrently, so they must not share bytes.
+    auto all_positive = parallel_reduce(
+        num_iterations, true, [&](size_t i) { return values[i] > 0; }, std::logical_and<>());
+    EXPECT_TRUE(all_positive);
+    auto any_equal = parallel_reduce(
+        num_iterations, false, [&](size_t i) { return values[i] == num_iterations; }, std::logical_or<>());
+    EXPECT_TRUE(any_equal);
+}
+
+TEST(Thread, ParallelReduceIsOrdered)
+{
+    // String concatenation is associative but not commutative, so this checks chunks are combined in index order.
+    constexpr size_t num_iterations = 200;
+    auto result = parallel_reduce(
+        num_iterations,
+        std::string(),
+        [](size_t i) { return std::string(1, static_cast<char>('a' + (i % 26))); },
+        [](const std::string& a, const std::string& b) { return a + b; });
+
+    std::string expected;
+    for (size_t i = 0; i < num_iterations; ++i) {
+        expected += static_cast<char>('a' + (i % 26));
+    }
+    EXPECT_EQ(result, expected);
+}
+
+} // namespace barretenberg::test_thread
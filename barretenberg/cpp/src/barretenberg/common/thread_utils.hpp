@@ -1,3 +1,4 @@
+#pragma once
 #include "thread.hpp"
 
 namespace barretenberg::thread_utils {
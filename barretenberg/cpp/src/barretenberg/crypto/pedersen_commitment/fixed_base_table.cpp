@@ -0,0 +1,83 @@
+#include "./fixed_base_table.hpp"
+#include <map>
+#include <memory>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#include <shared_mutex>
+#endif
+
+namespace crypto {
+
+template <typename Curve> fixed_base_table<Curve>::fixed_base_table(const AffineElement& generator)
+{
+    std::vector<Element> table(NUM_WINDOWS * POINTS_PER_WINDOW);
+    Element window_base(generator);
+    for (size_t i = 0; i < NUM_WINDOWS; ++i) {
+        Element* window = &table[i * POINTS_PER_WINDOW];
+        window[0] = window_base;
+        for (size_t j = 1; j < POINTS_PER_WINDOW; ++j) {
+            window[j] = window[j - 1] + window_base;
+        }
+        window_base = window[POINTS_PER_WINDOW - 1] + window_base;
+    }
+    Element::batch_normalize(table.data(), table.size());
+
+    points.reserve(table.size());
+    for (const auto& point : table) {
+        points.emplace_back(point.x, point.y);
+    }
+}
+
+template <typename Curve> typename Curve::Element fixed_base_table<Curve>::mul(const uint256_t& scalar) const
+{
+    constexpr size_t WINDOWS_PER_LIMB = 64 / WINDOW_BITS;
+    constexpr uint64_t WINDOW_MASK = (1UL << WINDOW_BITS) - 1;
+
+    Element result = Curve::Group::point_at_infinity;
+    for (size_t i = 0; i < NUM_WINDOWS; ++i) {
+        const uint64_t limb = scalar.data[i / WINDOWS_PER_LIMB];
+        const uint64_t digit = (limb >> ((i % WINDOWS_PER_LIMB) * WINDOW_BITS)) & WINDOW_MASK;
+        if (digit != 0) {
+            result += points[i * POINTS_PER_WINDOW + static_cast<size_t>(digit) - 1];
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Get the table for `generator`, building it if this is the first time the generator is used.
+ *
+ * @details Lookups take a shared lock. A missing table is built without holding the lock, so concurrent first uses
+ * of different generators do not serialise, and the first table to be inserted wins. Tables are never evicted, so the
+ * returned reference stays valid.
+ */
+template <typename Curve> const fixed_base_table<Curve>& fixed_base_table<Curve>::get(const AffineElement& generator)
+{
+    using Key = std::pair<uint256_t, uint256_t>;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::map<Key, std::unique_ptr<const fixed_base_table>> tables;
+#ifndef NO_MULTITHREADING
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::shared_mutex tables_mutex;
+#endif
+
+    const Key key{ uint256_t(generator.x), uint256_t(generator.y) };
+    {
+#ifndef NO_MULTITHREADING
+        std::shared_lock lock(tables_mutex);
+#endif
+        auto it = tables.find(key);
+        if (it != tables.end()) {
+            return *it->second;
+        }
+    }
+
+    auto table = std::make_unique<const fixed_base_table>(generator);
+#ifndef NO_MULTITHREADING
+    std::unique_lock lock(tables_mutex);
+#endif
+    return *tables.try_emplace(key, std::move(table)).first->second;
+}
+
+template class fixed_base_table<curve::Grumpkin>;
+} // namespace crypto
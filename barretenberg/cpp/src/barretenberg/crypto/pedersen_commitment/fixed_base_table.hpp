@@ -0,0 +1,44 @@
+#pragma once
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <vector>
+
+namespace crypto {
+
+/**
+ * @brief Precomputed window table for multiplying a fixed generator point by a scalar.
+ *
+ * @details The scalar is split into NUM_WINDOWS windows of WINDOW_BITS bits. For window i the table stores the affine
+ * points j.2^{i * WINDOW_BITS}.[G] for j = 1, ..., 2^WINDOW_BITS - 1, so a multiplication is at most NUM_WINDOWS
+ * mixed additions and no doublings.
+ *
+ *          Tables are built on first use by `get` and shared by every thread for the lifetime of the process, in the
+ *          same spirit as `generator_data::default_data`. Unlike `generator_data`, the cache is safe to extend from
+ *          several threads at once.
+ *
+ * @tparam Curve
+ */
+template <typename Curve> class fixed_base_table {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    static constexpr size_t WINDOW_BITS = 4;
+    static constexpr size_t NUM_WINDOWS = 256 / WINDOW_BITS;
+    // The zero entry of each window is implicit
+    static constexpr size_t POINTS_PER_WINDOW = (1UL << WINDOW_BITS) - 1;
+
+    explicit fixed_base_table(const AffineElement& generator);
+
+    /**
+     * @brief Returns scalar.[G], in projective form so that callers can accumulate before normalising
+     */
+    [[nodiscard]] Element mul(const uint256_t& scalar) const;
+
+    static const fixed_base_table& get(const AffineElement& generator);
+
+  private:
+    std::vector<AffineElement> points;
+};
+
+extern template class fixed_base_table<curve::Grumpkin>;
+} // namespace crypto
@@ -20,14 +20,27 @@ namespace crypto {
 template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
+{
+    return commit_native_projective(inputs, context).normalize();
+}
+
+/**
+ * @brief As `commit_native`, but leaves the result in projective form so that callers adding further terms, or
+ * normalising many results at once, do not pay for an inversion here.
+ *
+ * @details The generators are fixed, so each term is computed with the generator's precomputed `fixed_base_table`.
+ */
+template <typename Curve>
+typename Curve::Element pedersen_commitment_base<Curve>::commit_native_projective(const std::vector<Fq>& inputs,
+                                                                                  const GeneratorContext context)
 {
     const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
     Element result = Group::point_at_infinity;
 
     for (size_t i = 0; i < inputs.size(); ++i) {
-        result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+        result += fixed_base_table<Curve>::get(generators[i]).mul(static_cast<uint256_t>(inputs[i]));
     }
-    return result.normalize();
+    return result;
 }
 template class pedersen_commitment_base<curve::Grumpkin>;
 } // namespace crypto
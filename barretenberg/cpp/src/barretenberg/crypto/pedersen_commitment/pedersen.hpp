@@ -2,6 +2,7 @@
 
 #pragma once
 #include "../generators/generator_data.hpp"
+#include "./fixed_base_table.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <array>
@@ -28,6 +29,7 @@ template <typename Curve> class pedersen_commitment_base {
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
 
     static AffineElement commit_native(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static Element commit_native_projective(const std::vector<Fq>& inputs, GeneratorContext context = {});
 };
 
 extern template class pedersen_commitment_base<curve::Grumpkin>;
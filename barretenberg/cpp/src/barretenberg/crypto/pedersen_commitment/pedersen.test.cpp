@@ -28,6 +28,20 @@ TEST(Pedersen, CommitmentWithZero)
     EXPECT_EQ(r, expected);
 }
 
+TEST(Pedersen, FixedBaseTableMatchesScalarMul)
+{
+    using Table = fixed_base_table<curve::Grumpkin>;
+    const auto generator = pedersen_commitment::GeneratorContext().generators->get(1)[0];
+    const auto& table = Table::get(generator);
+    EXPECT_EQ(&table, &Table::get(generator));
+
+    const std::vector<uint256_t> scalars = { 0, 1, 15, 16, uint256_t(fr::random_element()), -uint256_t(1) };
+    for (const auto& scalar : scalars) {
+        grumpkin::g1::element expected = grumpkin::g1::element(generator) * grumpkin::fr(scalar);
+        EXPECT_EQ(table.mul(scalar).normalize(), expected.normalize());
+    }
+}
+
 TEST(Pedersen, CommitmentProf)
 {
     GTEST_SKIP() << "Skipping mini profiler.";
@@ -58,8 +58,8 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
-    return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
+    Element result = fixed_base_table<Curve>::get(length_generator).mul(inputs.size());
+    return (result + pedersen_commitment_base<Curve>::commit_native_projective(inputs, context)).normalize().x;
 }
 
 /**
@@ -81,5 +81,15 @@ typename Curve::BaseField pedersen_hash_base<Curve>::hash_buffer(const std::vect
     return result;
 }
 
+/**
+ * @brief Hash a batch of pairs, e.g. one layer of a Merkle tree. See the generic `hash_batch`.
+ */
+template <typename Curve>
+std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::hash_batch(std::span<const std::array<Fq, 2>> inputs,
+                                                                             const GeneratorContext context)
+{
+    return hash_batch<2>(inputs, context);
+}
+
 template class pedersen_hash_base<curve::Grumpkin>;
 } // namespace crypto
\ No newline at end of file
@@ -21,4 +21,24 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
-} // namespace crypto
\ No newline at end of file
+TEST(Pedersen, HashBatch)
+{
+    for (const size_t num_hashes : { 0UL, 1UL, 100UL }) {
+        std::vector<std::array<fr, 2>> pairs(num_hashes);
+        std::vector<std::array<fr, 3>> triples(num_hashes);
+        for (size_t i = 0; i < num_hashes; ++i) {
+            pairs[i] = { fr::random_element(), fr::random_element() };
+            triples[i] = { fr::random_element(), fr::random_element(), fr::random_element() };
+        }
+        auto pair_hashes = pedersen_hash::hash_batch(pairs, 5);
+        auto triple_hashes = pedersen_hash::hash_batch<3>(triples);
+        ASSERT_EQ(pair_hashes.size(), num_hashes);
+        ASSERT_EQ(triple_hashes.size(), num_hashes);
+        for (size_t i = 0; i < num_hashes; ++i) {
+            EXPECT_EQ(pair_hashes[i], pedersen_hash::hash({ pairs[i][0], pairs[i][1] }, 5));
+            EXPECT_EQ(triple_hashes[i], pedersen_hash::hash({ triples[i][0], triples[i][1], triples[i][2] }));
+        }
+    }
+}
+
+} // namespace crypto
@@ -15,6 +15,7 @@
 #include "barretenberg/dsl/acir_format/sha256_constraint.hpp"
 #include "barretenberg/proof_system/arithmetization/gate_data.hpp"
 #include "serde/index.hpp"
+#include <algorithm>
 #include <iterator>
 
 namespace acir_format {
@@ -260,58 +261,123 @@ void handle_memory_op(Circuit::Opcode::MemoryOp const& mem_op, BlockConstraint&
     block.trace.push_back(acir_mem_op);
 }
 
+void handle_opcode(Circuit::Opcode const& gate,
+                   acir_format& af,
+                   std::map<uint32_t, BlockConstraint>& block_id_to_block_constraint)
+{
+    std::visit(
+        [&](auto&& arg) {
+            using T = std::decay_t<decltype(arg)>;
+            if constexpr (std::is_same_v<T, Circuit::Opcode::Arithmetic>) {
+                handle_arithmetic(arg, af);
+            } else if constexpr (std::is_same_v<T, Circuit::Opcode::BlackBoxFuncCall>) {
+                handle_blackbox_func_call(arg, af);
+            } else if constexpr (std::is_same_v<T, Circuit::Opcode::MemoryInit>) {
+                auto block = handle_memory_init(arg);
+                uint32_t block_id = arg.block_id.value;
+                block_id_to_block_constraint[block_id] = block;
+            } else if constexpr (std::is_same_v<T, Circuit::Opcode::MemoryOp>) {
+                auto block = block_id_to_block_constraint.find(arg.block_id.value);
+                if (block == block_id_to_block_constraint.end()) {
+                    throw_or_abort("unitialized MemoryOp");
+                }
+                handle_memory_op(arg, block->second);
+            }
+        },
+        gate.value);
+}
+
+/**
+ * @brief Decode a bincode serialized Circuit::Circuit straight into an acir_format
+ *
+ * @details Rather than materialising the whole Circuit::Circuit, the fields are read in their serialized order and
+ * each opcode is converted as soon as it has been decoded. The deserializer reads `buf` in place.
+ */
 acir_format circuit_buf_to_acir_format(std::vector<uint8_t> const& buf)
 {
-    auto circuit = Circuit::Circuit::bincodeDeserialize(buf);
+    auto deserializer = serde::BincodeDeserializer(buf);
+    deserializer.increase_container_depth();
 
     acir_format af;
-    af.varnum = circuit.current_witness_index + 1;
-    af.public_inputs = join({ map(circuit.public_parameters.value, [](auto e) { return e.value; }),
-                              map(circuit.return_values.value, [](auto e) { return e.value; }) });
+    af.varnum = serde::Deserializable<uint32_t>::deserialize(deserializer) + 1;
+
+    // The fewest bytes an opcode is encoded in: its variant index
+    constexpr size_t MIN_ENCODED_OPCODE_SIZE = sizeof(uint32_t);
+    const size_t num_opcodes = deserializer.deserialize_len();
+    // Arithmetic gates usually make up the bulk of a circuit, so size for the case where every opcode is one. The
+    // length is untrusted, so reserve no more than the remaining bytes could encode.
+    af.constraints.reserve(
+        std::min(num_opcodes, (buf.size() - deserializer.get_buffer_offset()) / MIN_ENCODED_OPCODE_SIZE));
     std::map<uint32_t, BlockConstraint> block_id_to_block_constraint;
-    for (auto gate : circuit.opcodes) {
-        std::visit(
-            [&](auto&& arg) {
-                using T = std::decay_t<decltype(arg)>;
-                if constexpr (std::is_same_v<T, Circuit::Opcode::Arithmetic>) {
-                    handle_arithmetic(arg, af);
-                } else if constexpr (std::is_same_v<T, Circuit::Opcode::BlackBoxFuncCall>) {
-                    handle_blackbox_func_call(arg, af);
-                } else if constexpr (std::is_same_v<T, Circuit::Opcode::MemoryInit>) {
-                    auto block = handle_memory_init(arg);
-                    uint32_t block_id = arg.block_id.value;
-                    block_id_to_block_constraint[block_id] = block;
-                } else if constexpr (std::is_same_v<T, Circuit::Opcode::MemoryOp>) {
-                    auto block = block_id_to_block_constraint.find(arg.block_id.value);
-                    if (block == block_id_to_block_constraint.end()) {
-                        throw_or_abort("unitialized MemoryOp");
-                    }
-                    handle_memory_op(arg, block->second);
-                }
-            },
-            gate.value);
+    for (size_t i = 0; i < num_opcodes; ++i) {
+        handle_opcode(serde::Deserializable<Circuit::Opcode>::deserialize(deserializer),
+                      af,
+                      block_id_to_block_constraint);
     }
     for (const auto& [block_id, block] : block_id_to_block_constraint) {
         if (!block.trace.empty()) {
             af.block_constraints.push_back(block);
         }
     }
+
+    // The remaining fields are small compared to the opcodes
+    serde::Deserializable<std::vector<Circuit::Witness>>::deserialize(deserializer); // private_parameters
+    auto public_parameters = serde::Deserializable<Circuit::PublicInputs>::deserialize(deserializer);
+    auto return_values = serde::Deserializable<Circuit::PublicInputs>::deserialize(deserializer);
+    serde::Deserializable<std::vector<std::tuple<Circuit::OpcodeLocation, std::string>>>::deserialize(
+        deserializer); // assert_messages
+    deserializer.decrease_container_depth();
+    if (deserializer.get_buffer_offset() < buf.size()) {
+        throw_or_abort("Some input bytes were not read");
+    }
+
+    af.public_inputs.reserve(public_parameters.value.size() + return_values.value.size());
+    for (const auto& e : public_parameters.value) {
+        af.public_inputs.push_back(e.value);
+    }
+    for (const auto& e : return_values.value) {
+        af.public_inputs.push_back(e.value);
+    }
     return af;
 }
 
+/**
+ * @brief Decode a bincode serialized WitnessMap::WitnessMap straight into a WitnessVector
+ *
+ * @details The entries of a serialized map are in increasing witness order, so each value is appended as it is read,
+ * with any gaps in the witness indices filled with zeros.
+ */
 WitnessVector witness_buf_to_witness_data(std::vector<uint8_t> const& buf)
 {
-    auto w = WitnessMap::WitnessMap::bincodeDeserialize(buf);
+    auto deserializer = serde::BincodeDeserializer(buf);
+    deserializer.increase_container_depth();
+
+    // The fewest bytes an entry is encoded in: the witness index and the length of its value
+    constexpr size_t MIN_ENCODED_ENTRY_SIZE = sizeof(uint32_t) + sizeof(uint64_t);
+    const size_t num_entries = deserializer.deserialize_len();
     WitnessVector wv;
+    // The length is untrusted, so reserve no more than the remaining bytes could encode
+    wv.reserve(std::min(num_entries, (buf.size() - deserializer.get_buffer_offset()) / MIN_ENCODED_ENTRY_SIZE));
     size_t index = 1;
-    for (auto& e : w.value) {
-        while (index < e.first.value) {
+    uint32_t previous_witness = 0;
+    for (size_t i = 0; i < num_entries; ++i) {
+        const auto witness = serde::Deserializable<WitnessMap::Witness>::deserialize(deserializer);
+        const auto value = deserializer.deserialize_str();
+        if (i > 0 && witness.value <= previous_witness) {
+            throw_or_abort("Witness map entries are not in increasing order");
+        }
+        previous_witness = witness.value;
+        while (index < witness.value) {
             wv.push_back(barretenberg::fr(0));
             index++;
         }
-        wv.push_back(barretenberg::fr(uint256_t(e.second)));
+        wv.push_back(barretenberg::fr(uint256_t(value)));
         index++;
     }
+    deserializer.decrease_container_depth();
+    if (deserializer.get_buffer_offset() < buf.size()) {
+        throw_or_abort("Some input bytes were not read");
+    }
     return wv;
 }
 
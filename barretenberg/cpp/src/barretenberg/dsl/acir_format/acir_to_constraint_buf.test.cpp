@@ -0,0 +1,320 @@
+#include "acir_to_constraint_buf.hpp"
+#include "barretenberg/common/container.hpp"
+
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace acir_format::tests {
+namespace {
+
+/**
+ * @brief Decode a circuit the way circuit_buf_to_acir_format did before it read the buffer in a single pass: through a
+ * fully materialised Circuit::Circuit. Kept as a reference for the single-pass decoder.
+ */
+acir_format reference_circuit_buf_to_acir_format(std::vector<uint8_t> const& buf)
+{
+    auto circuit = Circuit::Circuit::bincodeDeserialize(buf);
+
+    acir_format af;
+    af.varnum = circuit.current_witness_index + 1;
+    af.public_inputs = join({ map(circuit.public_parameters.value, [](auto e) { return e.value; }),
+                              map(circuit.return_values.value, [](auto e) { return e.value; }) });
+    std::map<uint32_t, BlockConstraint> block_id_to_block_constraint;
+    for (const auto& gate : circuit.opcodes) {
+        handle_opcode(gate, af, block_id_to_block_constraint);
+    }
+    for (const auto& [block_id, block] : block_id_to_block_constraint) {
+        if (!block.trace.empty()) {
+            af.block_constraints.push_back(block);
+        }
+    }
+    return af;
+}
+
+/**
+ * @brief Decode a witness map through a fully materialised WitnessMap::WitnessMap, as witness_buf_to_witness_data
+ * did before it read the buffer in a single pass.
+ */
+WitnessVector reference_witness_buf_to_witness_data(std::vector<uint8_t> const& buf)
+{
+    auto w = WitnessMap::WitnessMap::bincodeDeserialize(buf);
+    WitnessVector wv;
+    size_t index = 1;
+    for (auto& e : w.value) {
+        while (index < e.first.value) {
+            wv.push_back(barretenberg::fr(0));
+            index++;
+        }
+        wv.push_back(barretenberg::fr(uint256_t(e.second)));
+        index++;
+    }
+    return wv;
+}
+
+// Field elements are serialized as 64 hex digits
+std::string field_string(uint64_t value)
+{
+    std::ostringstream result;
+    result << std::hex << std::setw(64) << std::setfill('0') << value;
+    return result.str();
+}
+
+Circuit::Witness witness(uint32_t index)
+{
+    return Circuit::Witness{ .value = index };
+}
+
+Circuit::FunctionInput input(uint32_t index, uint32_t num_bits = 32)
+{
+    return Circuit::FunctionInput{ .witness = witness(index), .num_bits = num_bits };
+}
+
+std::vector<Circuit::FunctionInput> inputs(uint32_t first, uint32_t count, uint32_t num_bits = 8)
+{
+    std::vector<Circuit::FunctionInput> result;
+    for (uint32_t i = 0; i < count; ++i) {
+        result.push_back(input(first + i, num_bits));
+    }
+    return result;
+}
+
+std::vector<Circuit::Witness> witnesses(uint32_t first, uint32_t count)
+{
+    std::vector<Circuit::Witness> result;
+    for (uint32_t i = 0; i < count; ++i) {
+        result.push_back(witness(first + i));
+    }
+    return result;
+}
+
+Circuit::Expression expression(uint32_t a, uint32_t b, uint32_t c, uint64_t q_c)
+{
+    return Circuit::Expression{
+        .mul_terms = { { field_string(3), witness(a), witness(b) } },
+        .linear_combinations = { { field_string(1), witness(a) }, { field_string(5), witness(c) } },
+        .q_c = field_string(q_c),
+    };
+}
+
+Circuit::Expression constant(uint64_t value)
+{
+    return Circuit::Expression{ .mul_terms = {}, .linear_combinations = {}, .q_c = field_string(value) };
+}
+
+template <typename BlackBoxCall> Circuit::Opcode black_box(BlackBoxCall call)
+{
+    return Circuit::Opcode{ .value = Circuit::Opcode::BlackBoxFuncCall{
+                                .value = Circuit::BlackBoxFuncCall{ .value = std::move(call) } } };
+}
+
+/**
+ * @brief A circuit with every kind of opcode and black box call, two public parameters, a return value and an assert
+ * message. The witness indices are arbitrary, as the circuit is only decoded and never built.
+ */
+Circuit::Circuit make_circuit_with_every_opcode()
+{
+    using BlackBox = Circuit::BlackBoxFuncCall;
+    std::vector<Circuit::Opcode> opcodes;
+
+    opcodes.push_back(Circuit::Opcode{ .value = Circuit::Opcode::Arithmetic{ .value = expression(1, 2, 3, 7) } });
+    opcodes.push_back(black_box(BlackBox::AND{ .lhs = input(1), .rhs = input(2), .output = witness(3) }));
+    opcodes.push_back(black_box(BlackBox::XOR{ .lhs = input(4), .rhs = input(5), .output = witness(6) }));
+    opcodes.push_back(black_box(BlackBox::RANGE{ .input = input(7, 16) }));
+    opcodes.push_back(black_box(BlackBox::SHA256{ .inputs = inputs(10, 4), .outputs = witnesses(20, 32) }));
+    opcodes.push_back(black_box(BlackBox::Blake2s{ .inputs = inputs(10, 4), .outputs = witnesses(60, 32) }));
+    opcodes.push_back(black_box(BlackBox::SchnorrVerify{ .public_key_x = input(1, 254),
+                                                          .public_key_y = input(2, 254),
+                                                          .signature = inputs(100, 64),
+                                                          .message = inputs(10, 4),
+                                                          .output = witness(8) }));
+    opcodes.push_back(black_box(BlackBox::PedersenCommitment{
+        .inputs = inputs(1, 3, 254), .domain_separator = 5, .outputs = { witness(9), witness(11) } }));
+    opcodes.push_back(
+        black_box(BlackBox::PedersenHash{ .inputs = inputs(1, 3, 254), .domain_separator = 2, .output = witness(12) }));
+    opcodes.push_back(black_box(BlackBox::HashToField128Security{ .inputs = inputs(10, 4), .output = witness(13) }));
+    opcodes.push_back(black_box(BlackBox::EcdsaSecp256k1{ .public_key_x = inputs(200, 32),
+                                                           .public_key_y = inputs(232, 32),
+                                                           .signature = inputs(264, 64),
+                                                           .hashed_message = inputs(328, 32),
+                                                           .output = witness(14) }));
+    opcodes.push_back(black_box(BlackBox::EcdsaSecp256r1{ .public_key_x = inputs(232, 32),
+                                                           .public_key_y = inputs(200, 32),
+                                                           .signature = inputs(264, 64),
+                                                           .hashed_message = inputs(328, 32),
+                                                           .output = witness(15) }));
+    opcodes.push_back(black_box(BlackBox::FixedBaseScalarMul{
+        .low = input(1, 128), .high = input(2, 126), .outputs = { witness(16), witness(17) } }));
+    opcodes.push_back(black_box(BlackBox::Keccak256{ .inputs = inputs(10, 4), .outputs = witnesses(20, 32) }));
+    opcodes.push_back(black_box(BlackBox::Keccak256VariableLength{
+        .inputs = inputs(10, 4), .var_message_size = input(18), .outputs = witnesses(60, 32) }));
+    // One recursion constraint with an input aggregation object and one without
+    const auto aggregation_object_size = static_cast<uint32_t>(RecursionConstraint::AGGREGATION_OBJECT_SIZE);
+    for (const bool has_input_aggregation_object : { true, false }) {
+        std::optional<std::vector<Circuit::FunctionInput>> input_aggregation_object;
+        if (has_input_aggregation_object) {
+            input_aggregation_object = inputs(400, aggregation_object_size, 254);
+        }
+        opcodes.push_back(black_box(BlackBox::RecursiveAggregation{
+            .verification_key = inputs(500, 8, 254),
+            .proof = inputs(600, 8, 254),
+            .public_inputs = inputs(1, 2, 254),
+            .key_hash = input(19, 254),
+            .input_aggregation_object = input_aggregation_object,
+            .output_aggregation_object = witnesses(420, aggregation_object_size) }));
+    }
+
+    // Directives and Brillig calls only compute witnesses, and add no constraints
+    opcodes.push_back(Circuit::Opcode{ .value = Circuit::Opcode::Directive{
+                                           .value = Circuit::Directive{ .value = Circuit::Directive::ToLeRadix{
+                                                                            .a = expression(1, 2, 3, 0),
+                                                                            .b = witnesses(700, 8),
+                                                                            .radix = 2 } } } });
+    const Circuit::Brillig brillig{
+        .inputs = { Circuit::BrilligInputs{ .value = Circuit::BrilligInputs::Single{ .value = constant(4) } } },
+        .outputs = { Circuit::BrilligOutputs{ .value = Circuit::BrilligOutputs::Simple{ .value = witness(20) } } },
+        .bytecode = { Circuit::BrilligOpcode{ .value = Circuit::BrilligOpcode::Stop{} } },
+        .predicate = constant(1),
+    };
+    opcodes.push_back(Circuit::Opcode{ .value = Circuit::Opcode::Brillig{ .value = brillig } });
+
+    // Block 0 is only read from, so it is a ROM block. Block 1 is written to, so it is a RAM block. Block 2 is never
+    // accessed, so it is left out.
+    for (uint32_t block_id = 0; block_id < 3; ++block_id) {
+        opcodes.push_back(Circuit::Opcode{ .value = Circuit::Opcode::MemoryInit{
+                                               .block_id = Circuit::BlockId{ .value = block_id },
+                                               .init = witnesses(800 + 10 * block_id, 4) } });
+    }
+    for (uint32_t i = 0; i < 4; ++i) {
+        const uint32_t block_id = i % 2;
+        const uint64_t operation = block_id == 1 && i == 3 ? 1 : 0;
+        opcodes.push_back(Circuit::Opcode{ .value = Circuit::Opcode::MemoryOp{
+                                               .block_id = Circuit::BlockId{ .value = block_id },
+                                               .op = Circuit::MemOp{ .operation = constant(operation),
+                                                                     .index = constant(i % 4),
+                                                                     .value = expression(900 + i, 0, 0, 0) },
+                                               .predicate = std::nullopt } });
+    }
+
+    return Circuit::Circuit{
+        .current_witness_index = 1000,
+        .opcodes = opcodes,
+        .private_parameters = witnesses(1, 2),
+        .public_parameters = Circuit::PublicInputs{ .value = { witness(3), witness(7) } },
+        .return_values = Circuit::PublicInputs{ .value = { witness(12) } },
+        .assert_messages = { { Circuit::OpcodeLocation{ .value = Circuit::OpcodeLocation::Acir{ .value = 0 } },
+                               "arithmetic gate failed" } },
+    };
+}
+
+// Appends a witness map entry to a bincode buffer, to build maps that WitnessMap::WitnessMap cannot hold
+void append_witness_entry(std::vector<uint8_t>& buf, uint32_t index, uint64_t value)
+{
+    for (size_t i = 0; i < sizeof(index); ++i) {
+        buf.push_back(static_cast<uint8_t>(index >> (8 * i)));
+    }
+    const std::string value_string = field_string(value);
+    const uint64_t length = value_string.size();
+    for (size_t i = 0; i < sizeof(length); ++i) {
+        buf.push_back(static_cast<uint8_t>(length >> (8 * i)));
+    }
+    buf.insert(buf.end(), value_string.begin(), value_string.end());
+}
+
+std::vector<uint8_t> witness_map_buf(std::vector<std::pair<uint32_t, uint64_t>> const& entries)
+{
+    std::vector<uint8_t> buf;
+    const uint64_t num_entries = entries.size();
+    for (size_t i = 0; i < sizeof(num_entries); ++i) {
+        buf.push_back(static_cast<uint8_t>(num_entries >> (8 * i)));
+    }
+    for (const auto& [index, value] : entries) {
+        append_witness_entry(buf, index, value);
+    }
+    return buf;
+}
+
+} // namespace
+
+TEST(AcirToConstraintBuf, CircuitDecoderMatchesReference)
+{
+    const auto buf = make_circuit_with_every_opcode().bincodeSerialize();
+    const auto af = circuit_buf_to_acir_format(buf);
+    EXPECT_TRUE(af == reference_circuit_buf_to_acir_format(buf));
+
+    // Check that every kind of constraint made it through, so the comparison above covers them all
+    EXPECT_EQ(af.varnum, 1001U);
+    EXPECT_EQ(af.public_inputs, std::vector<uint32_t>({ 3, 7, 12 }));
+    EXPECT_EQ(af.constraints.size(), 1UL);
+    EXPECT_EQ(af.logic_constraints.size(), 2UL);
+    EXPECT_EQ(af.range_constraints.size(), 1UL);
+    EXPECT_EQ(af.sha256_constraints.size(), 1UL);
+    EXPECT_EQ(af.blake2s_constraints.size(), 1UL);
+    EXPECT_EQ(af.schnorr_constraints.size(), 1UL);
+    EXPECT_EQ(af.pedersen_constraints.size(), 1UL);
+    EXPECT_EQ(af.pedersen_hash_constraints.size(), 1UL);
+    EXPECT_EQ(af.hash_to_field_constraints.size(), 1UL);
+    EXPECT_EQ(af.ecdsa_k1_constraints.size(), 1UL);
+    EXPECT_EQ(af.ecdsa_r1_constraints.size(), 1UL);
+    EXPECT_EQ(af.fixed_base_scalar_mul_constraints.size(), 1UL);
+    EXPECT_EQ(af.keccak_constraints.size(), 1UL);
+    EXPECT_EQ(af.keccak_var_constraints.size(), 1UL);
+    EXPECT_EQ(af.recursion_constraints.size(), 2UL);
+    ASSERT_EQ(af.block_constraints.size(), 2UL);
+    EXPECT_EQ(af.block_constraints[0].type, BlockType::ROM);
+    EXPECT_EQ(af.block_constraints[1].type, BlockType::RAM);
+}
+
+TEST(AcirToConstraintBuf, WitnessDecoderMatchesReference)
+{
+    // Witness 0 is never set, and the indices skip over 2-3, 5-9 and 11-99
+    WitnessMap::WitnessMap witness_map;
+    for (const uint32_t index : { 1U, 4U, 10U, 100U, 101U }) {
+        witness_map.value[WitnessMap::Witness{ .value = index }] = field_string(1000 + index);
+    }
+    const auto buf = witness_map.bincodeSerialize();
+    const auto wv = witness_buf_to_witness_data(buf);
+    EXPECT_EQ(wv, reference_witness_buf_to_witness_data(buf));
+    ASSERT_EQ(wv.size(), 101UL);
+    EXPECT_EQ(wv[0], barretenberg::fr(1001));
+    EXPECT_EQ(wv[1], barretenberg::fr(0));
+    EXPECT_EQ(wv[99], barretenberg::fr(1100));
+
+    // The hand-built encoding used by the tests below agrees with the generated serializer
+    EXPECT_EQ(buf, witness_map_buf({ { 1, 1001 }, { 4, 1004 }, { 10, 1010 }, { 100, 1100 }, { 101, 1101 } }));
+}
+
+TEST(AcirToConstraintBuf, WitnessDecoderRejectsNonIncreasingIndices)
+{
+    EXPECT_THROW(witness_buf_to_witness_data(witness_map_buf({ { 1, 1 }, { 3, 3 }, { 3, 4 } })), std::runtime_error);
+    EXPECT_THROW(witness_buf_to_witness_data(witness_map_buf({ { 1, 1 }, { 5, 5 }, { 2, 2 } })), std::runtime_error);
+}
+
+TEST(AcirToConstraintBuf, DecodersRejectTrailingBytes)
+{
+    auto circuit_buf = make_circuit_with_every_opcode().bincodeSerialize();
+    circuit_buf.push_back(0);
+    EXPECT_THROW(circuit_buf_to_acir_format(circuit_buf), std::runtime_error);
+
+    auto witness_buf = witness_map_buf({ { 1, 1 }, { 2, 2 } });
+    witness_buf.push_back(0);
+    EXPECT_THROW(witness_buf_to_witness_data(witness_buf), std::runtime_error);
+}
+
+TEST(AcirToConstraintBuf, DecodersBoundReservationsByInputSize)
+{
+    // Lengths far beyond what the remaining bytes could hold must fail on the missing bytes, rather than reserve
+    // gigabytes first
+    std::vector<uint8_t> circuit_buf = { 0, 0, 0, 0 }; // current_witness_index
+    const uint64_t huge_length = BINCODE_MAX_LENGTH;
+    for (size_t i = 0; i < sizeof(huge_length); ++i) {
+        circuit_buf.push_back(static_cast<uint8_t>(huge_length >> (8 * i)));
+    }
+    EXPECT_THROW(circuit_buf_to_acir_format(circuit_buf), std::runtime_error);
+
+    std::vector<uint8_t> witness_buf(circuit_buf.begin() + 4, circuit_buf.end());
+    EXPECT_THROW(witness_buf_to_witness_data(witness_buf), std::runtime_error);
+}
+
+} // namespace acir_format::tests
@@ -10,6 +10,8 @@ struct MemOp {
     uint8_t access_type;
     poly_triple index;
     poly_triple value;
+
+    friend bool operator==(MemOp const& lhs, MemOp const& rhs) = default;
 };
 
 enum BlockType {
@@ -21,6 +23,8 @@ struct BlockConstraint {
     std::vector<poly_triple> init;
     std::vector<MemOp> trace;
     BlockType type;
+
+    friend bool operator==(BlockConstraint const& lhs, BlockConstraint const& rhs) = default;
 };
 
 void create_block_constraints(Builder& builder,
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <span>
 #include <variant>
 
 #include "serde.hpp"
@@ -54,14 +55,15 @@ template <class D> class BinaryDeserializer {
     size_t container_depth_budget_;
 
   protected:
-    std::vector<uint8_t> bytes_;
+    // A view of the input, which must outlive the deserializer
+    std::span<const uint8_t> bytes_;
     uint8_t read_byte();
 
   public:
-    BinaryDeserializer(std::vector<uint8_t> bytes, size_t max_container_depth)
+    BinaryDeserializer(std::span<const uint8_t> bytes, size_t max_container_depth)
         : pos_(0)
         , container_depth_budget_(max_container_depth)
-        , bytes_(std::move(bytes))
+        , bytes_(bytes)
     {}
 
     std::string deserialize_str();
@@ -212,7 +214,7 @@ template <class D> uint8_t BinaryDeserializer<D>::read_byte()
     if (pos_ >= bytes_.size()) {
         throw_or_abort("Input is not large enough");
     }
-    return bytes_.at(pos_++);
+    return bytes_[pos_++];
 }
 
 inline bool is_valid_utf8(const std::string& input)
@@ -1,5 +1,6 @@
 #include "acir_composer.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/dsl/acir_format/acir_format.hpp"
 #include "barretenberg/dsl/acir_format/recursion_constraint.hpp"
@@ -9,9 +10,62 @@
 #include "barretenberg/plonk/proof_system/verification_key/sol_gen.hpp"
 #include "barretenberg/plonk/proof_system/verification_key/verification_key.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
+#include <algorithm>
+#include <atomic>
+#include <unordered_set>
 
 namespace acir_proofs {
 
+namespace {
+// Rough peak memory of one proof, in field elements per row of the circuit: the wire, permutation and lookup
+// polynomials in lagrange, monomial and coset form, the quotient, and the circuit builder's own copy of the witness.
+constexpr size_t PROOF_MEMORY_FIELDS_PER_ROW = 64;
+
+/**
+ * @brief Whether this circuit, once built with one witness, proves another by swapping in its values (see
+ * refill_witness) instead of being built again.
+ *
+ * @details The gadgets compute their intermediate witnesses while the circuit is built, so that only holds when the
+ * build added no variables but constants, leaving every value either a constant or an ACIR witness. Nor may anything
+ * be laid out by value: lookups, ROM/RAM records and range lists are all sorted by witness value when a proof
+ * finalises the circuit.
+ */
+bool is_witness_refillable(acir_format::Builder const& builder, acir_format::acir_format const& constraint_system)
+{
+    if (!builder.lookup_tables.empty() || !builder.rom_arrays.empty() || !builder.ram_arrays.empty() ||
+        !builder.memory_read_records.empty() || !builder.memory_write_records.empty() ||
+        !builder.cached_partial_non_native_field_multiplications.empty()) {
+        return false;
+    }
+    for (auto const& [tag, range_list] : builder.range_lists) {
+        if (!range_list.variable_indices.empty()) {
+            return false;
+        }
+    }
+    std::unordered_set<uint32_t> constant_indices;
+    for (auto const& [value, index] : builder.constant_variable_indices) {
+        constant_indices.insert(index);
+    }
+    for (size_t i = constraint_system.varnum; i < builder.variables.size(); ++i) {
+        if (!constant_indices.contains(static_cast<uint32_t>(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Replace the ACIR witness values of a circuit that is_witness_refillable, the way create_circuit_with_witness sets
+// them in a new one.
+void refill_witness(acir_format::Builder& builder,
+                    acir_format::acir_format const& constraint_system,
+                    acir_format::WitnessVector const& witness)
+{
+    std::fill(builder.variables.begin() + 1, builder.variables.begin() + constraint_system.varnum, barretenberg::fr(0));
+    const size_t num_values = std::min(witness.size(), size_t(constraint_system.varnum) - 1);
+    std::copy_n(witness.begin(), num_values, builder.variables.begin() + 1);
+}
+} // namespace
+
 AcirComposer::AcirComposer(size_t size_hint, bool verbose)
     : size_hint_(size_hint)
     , verbose_(verbose)
@@ -75,6 +129,71 @@ std::vector<uint8_t> AcirComposer::create_proof(acir_format::acir_format& constr
     return proof;
 }
 
+size_t AcirComposer::get_max_concurrent_proofs(size_t memory_budget)
+{
+#ifdef __wasm__
+    static_cast<void>(memory_budget);
+    return 1;
+#else
+    const size_t proof_memory = PROOF_MEMORY_FIELDS_PER_ROW * sizeof(barretenberg::fr) * circuit_subgroup_size_;
+    const size_t max_proofs = memory_budget == 0 ? get_num_cpus() : memory_budget / std::max(proof_memory, size_t(1));
+    return std::clamp(max_proofs, size_t(1), get_num_cpus());
+#endif
+}
+
+std::vector<std::vector<uint8_t>> AcirComposer::create_proofs(acir_format::acir_format& constraint_system,
+                                                              std::vector<acir_format::WitnessVector> const& witnesses,
+                                                              bool is_recursive,
+                                                              size_t memory_budget)
+{
+    // Building the circuit without a witness also runs every lazy initialisation (e.g. of the plookup tables) the
+    // witness builders below would otherwise race on.
+    if (!proving_key_) {
+        init_proving_key(constraint_system);
+    }
+
+    const size_t num_slots = std::min(get_max_concurrent_proofs(memory_budget), witnesses.size());
+    vinfo("creating ", witnesses.size(), " proofs, ", num_slots, " at a time...");
+    // Each slot proves with its own key. A key is reused for the slot's next proof, the way create_proof reuses
+    // proving_key_.
+    std::vector<std::shared_ptr<proof_system::plonk::proving_key>> slot_keys(num_slots, proving_key_);
+#ifndef __wasm__
+    for (auto& key : slot_keys) {
+        key = proving_key_->share_precomputed();
+    }
+#endif
+
+    std::vector<std::vector<uint8_t>> proofs(witnesses.size());
+    std::atomic<size_t> next_proof = 0;
+    std::atomic<size_t> num_refilled = 0;
+    parallel_for(num_slots, [&](size_t slot) {
+        // A slot builds its circuit for its first proof, and after that only refills the witness if it can.
+        acir_format::Builder builder;
+        bool refill = false;
+        for (size_t i = next_proof++; i < witnesses.size(); i = next_proof++) {
+            if (refill) {
+                refill_witness(builder, constraint_system, witnesses[i]);
+                ++num_refilled;
+            } else {
+                builder = acir_format::Builder(size_hint_);
+                create_circuit_with_witness(builder, constraint_system, witnesses[i]);
+                refill = is_witness_refillable(builder, constraint_system);
+            }
+            acir_format::Composer composer(slot_keys[slot], nullptr);
+            if (is_recursive) {
+                auto prover = composer.create_prover(builder);
+                proofs[i] = prover.construct_proof().proof_data;
+            } else {
+                auto prover = composer.create_ultra_with_keccak_prover(builder);
+                proofs[i] = prover.construct_proof().proof_data;
+            }
+        }
+    });
+    num_refilled_witnesses_ = num_refilled;
+    vinfo("done.");
+    return proofs;
+}
+
 std::shared_ptr<proof_system::plonk::verification_key> AcirComposer::init_verification_key()
 {
     if (!proving_key_) {
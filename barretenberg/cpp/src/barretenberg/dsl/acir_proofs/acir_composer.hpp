@@ -20,6 +20,31 @@ class AcirComposer {
                                       acir_format::WitnessVector& witness,
                                       bool is_recursive);
 
+    /**
+     * @brief Proofs of this circuit for each of `witnesses`, in order.
+     *
+     * @details The proving key is built once for the whole batch, and the proofs run concurrently, each on its own
+     * view of the proving key that shares the precomputed polynomials. Each of those builds the circuit once and then
+     * only swaps in the witness values of the next proof, unless the circuit computes intermediate witnesses or lays
+     * anything out by value, in which case it is built again per proof. As many proofs run at once as fit in
+     * memory_budget bytes by a rough estimate of a proof's peak memory, up to one per cpu (0 means no budget).
+     */
+    std::vector<std::vector<uint8_t>> create_proofs(acir_format::acir_format& constraint_system,
+                                                    std::vector<acir_format::WitnessVector> const& witnesses,
+                                                    bool is_recursive,
+                                                    size_t memory_budget = 0);
+
+    /**
+     * @brief How many proofs of this circuit create_proofs runs at once within memory_budget bytes.
+     */
+    size_t get_max_concurrent_proofs(size_t memory_budget);
+
+    /**
+     * @brief How many proofs of the last create_proofs call refilled the witness of an existing circuit rather than
+     * building the circuit again.
+     */
+    size_t get_num_refilled_witnesses() const { return num_refilled_witnesses_; }
+
     void load_verification_key(proof_system::plonk::verification_key_data&& data);
 
     std::shared_ptr<proof_system::plonk::verification_key> init_verification_key();
@@ -42,6 +67,7 @@ class AcirComposer {
     size_t exact_circuit_size_;
     size_t total_circuit_size_;
     size_t circuit_subgroup_size_;
+    size_t num_refilled_witnesses_ = 0;
     std::shared_ptr<proof_system::plonk::proving_key> proving_key_;
     std::shared_ptr<proof_system::plonk::verification_key> verification_key_;
     bool verbose_ = true;
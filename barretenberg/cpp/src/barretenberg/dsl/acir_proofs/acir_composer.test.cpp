@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "acir_composer.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+
+namespace acir_proofs::tests {
+
+using namespace barretenberg;
+
+class AcirComposerTests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { srs::init_crs_factory("../srs_db/ignition"); }
+
+    // w3 = w1 * w2 + w1, with w3 public.
+    static acir_format::acir_format product_circuit()
+    {
+        poly_triple constraint{
+            .a = 1,
+            .b = 2,
+            .c = 3,
+            .q_m = 1,
+            .q_l = 1,
+            .q_r = 0,
+            .q_o = -1,
+            .q_c = 0,
+        };
+        return acir_format::acir_format{
+            .varnum = 4,
+            .public_inputs = { 3 },
+            .logic_constraints = {},
+            .range_constraints = {},
+            .sha256_constraints = {},
+            .schnorr_constraints = {},
+            .ecdsa_k1_constraints = {},
+            .ecdsa_r1_constraints = {},
+            .blake2s_constraints = {},
+            .keccak_constraints = {},
+            .keccak_var_constraints = {},
+            .pedersen_constraints = {},
+            .pedersen_hash_constraints = {},
+            .hash_to_field_constraints = {},
+            .fixed_base_scalar_mul_constraints = {},
+            .recursion_constraints = {},
+            .constraints = { constraint },
+            .block_constraints = {},
+        };
+    }
+
+    static acir_format::WitnessVector product_witness(fr const& a, fr const& b) { return { a, b, a * b + a }; }
+};
+
+// Proofs made concurrently with keys that share the precomputed polynomials all verify, and leave those polynomials
+// as they were.
+TEST_F(AcirComposerTests, ConcurrentProofsVerify)
+{
+    constexpr size_t NUM_PROOFS = 4;
+    auto constraint_system = product_circuit();
+    AcirComposer acir_composer(0, false);
+    auto proving_key = acir_composer.init_proving_key(constraint_system);
+    acir_composer.init_verification_key();
+
+    std::map<std::string, polynomial> before;
+    for (auto const& [label, polynomial] : proving_key->polynomial_store) {
+        before.emplace(label, barretenberg::polynomial(polynomial));
+    }
+
+    std::vector<std::vector<uint8_t>> proofs(NUM_PROOFS);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < NUM_PROOFS; ++i) {
+        threads.emplace_back([&, i]() {
+            auto builder = acir_format::create_circuit_with_witness(
+                constraint_system, product_witness(fr::random_element(), fr::random_element()));
+            acir_format::Composer composer(proving_key->share_precomputed(), nullptr);
+            auto prover = composer.create_ultra_with_keccak_prover(builder);
+            proofs[i] = prover.construct_proof().proof_data;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& proof : proofs) {
+        EXPECT_TRUE(acir_composer.verify_proof(proof, false));
+    }
+
+    for (auto const& [label, polynomial] : proving_key->polynomial_store) {
+        EXPECT_TRUE(before.at(label) == polynomial) << label;
+    }
+}
+
+// A batch of the same circuit, whose witnesses are refilled rather than rebuilt, proves each of its witnesses: the
+// proofs verify, except for the one whose witness does not satisfy the circuit.
+TEST_F(AcirComposerTests, CreateProofsRefillsWitnesses)
+{
+    auto constraint_system = product_circuit();
+    std::vector<acir_format::WitnessVector> witnesses;
+    for (size_t i = 0; i < 6; ++i) {
+        witnesses.push_back(product_witness(fr::random_element(), fr::random_element()));
+    }
+    witnesses[3][2] += 1;
+
+    AcirComposer acir_composer(0, false);
+    auto proofs = acir_composer.create_proofs(constraint_system, witnesses, false);
+    acir_composer.init_verification_key();
+    ASSERT_EQ(proofs.size(), witnesses.size());
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        EXPECT_EQ(acir_composer.verify_proof(proofs[i], false), i != 3) << "proof " << i;
+    }
+    // Every slot builds its circuit once and refills it for the rest of its proofs.
+    const size_t num_slots = std::min(acir_composer.get_max_concurrent_proofs(0), witnesses.size());
+    EXPECT_EQ(acir_composer.get_num_refilled_witnesses(), witnesses.size() - num_slots);
+
+    // A budget too small for two proofs at once leaves a single slot, which refills all but the first witness.
+    proofs = acir_composer.create_proofs(constraint_system, witnesses, false, 1);
+    EXPECT_EQ(acir_composer.get_num_refilled_witnesses(), witnesses.size() - 1);
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        EXPECT_EQ(acir_composer.verify_proof(proofs[i], false), i != 3) << "proof " << i;
+    }
+}
+
+} // namespace acir_proofs::tests
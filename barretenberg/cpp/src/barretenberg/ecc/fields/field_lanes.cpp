@@ -0,0 +1,503 @@
+#include "field_lanes.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#include <immintrin.h>
+#define FIELD_LANES_X64 1
+// The kernels are compiled for AVX-512 IFMA whatever the target architecture, and only run if the CPU has it.
+#define FIELD_LANES_TARGET __attribute__((target("avx512f,avx512ifma")))
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC sees the deliberately undefined source operand of the AVX-512 shift intrinsics as maybe uninitialized.
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#endif
+
+namespace barretenberg::field_lanes {
+
+namespace {
+std::atomic<bool> vector_kernels_enabled = true;
+} // namespace
+
+bool is_supported()
+{
+#ifdef FIELD_LANES_X64
+    static const bool supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+bool is_available()
+{
+    return vector_kernels_enabled.load(std::memory_order_relaxed) && is_supported();
+}
+
+void set_vector_kernels_enabled(const bool enabled)
+{
+    vector_kernels_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+#ifdef FIELD_LANES_X64
+namespace {
+
+constexpr size_t NUM_LIMBS = 5;
+constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+
+using Limbs = std::array<uint64_t, NUM_LIMBS>;
+
+// The 52-bit limbs of 16 * v, for v < 2^256 given as 64-bit words. A product of limbs is 2^260 times too small,
+// which the factor 16 on one operand makes up: (16 a)(b) / 2^260 = ab / 2^256, the Montgomery product of the field.
+constexpr Limbs to_limbs_times_16(const uint64_t* v)
+{
+    return { (v[0] << 4) & LIMB_MASK,
+             ((v[0] >> 48) | (v[1] << 16)) & LIMB_MASK,
+             ((v[1] >> 36) | (v[2] << 28)) & LIMB_MASK,
+             ((v[2] >> 24) | (v[3] << 40)) & LIMB_MASK,
+             v[3] >> 12 };
+}
+
+constexpr Limbs to_limbs(const uint64_t* v)
+{
+    return { v[0] & LIMB_MASK,
+             ((v[0] >> 52) | (v[1] << 12)) & LIMB_MASK,
+             ((v[1] >> 40) | (v[2] << 24)) & LIMB_MASK,
+             ((v[2] >> 28) | (v[3] << 36)) & LIMB_MASK,
+             v[3] >> 16 };
+}
+
+// 2^shift * v, for a v given in limbs with room for it.
+constexpr Limbs shift_limbs(const Limbs& v, const size_t shift)
+{
+    Limbs result{};
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        result[i] = (v[i] << shift) & LIMB_MASK;
+        if (i > 0 && shift > 0) {
+            result[i] |= v[i - 1] >> (52 - shift);
+        }
+    }
+    return result;
+}
+
+/**
+ * 8 field elements, limb l of element k in lane k of limbs[l].
+ *
+ * Elements come in as the coarse Montgomery form of the field (below 2p) and mont_mul returns them fully reduced.
+ * The bounds all rest on p < 2^254, as for the assembly field arithmetic.
+ */
+struct Lanes {
+    __m512i limbs[NUM_LIMBS];
+};
+
+// The 4 64-bit words of 8 elements, word w of element k in lane k of words[w].
+struct Words {
+    __m512i words[4];
+    __m512i& operator[](const size_t i) { return words[i]; }
+    const __m512i& operator[](const size_t i) const { return words[i]; }
+};
+
+template <typename Params> struct Kernels {
+    using Fr = field<Params>;
+    static_assert(Params::modulus_3 < 0x4000000000000000ULL);
+
+    static constexpr uint64_t MODULUS_WORDS[4] = {
+        Params::modulus_0, Params::modulus_1, Params::modulus_2, Params::modulus_3
+    };
+    static constexpr Limbs MODULUS = to_limbs(MODULUS_WORDS);
+    // -p^{-1} mod 2^52
+    static constexpr uint64_t MODULUS_INV = Params::r_inv & LIMB_MASK;
+    // Sums of up to 2^MAX_SUM_LOG2 products are reduced by subtracting 2^i p for each i below it.
+    static constexpr size_t MAX_SUM_LOG2 = 5;
+
+    FIELD_LANES_TARGET static __m512i broadcast(const uint64_t limb)
+    {
+        return _mm512_set1_epi64(static_cast<long long>(limb));
+    }
+
+    FIELD_LANES_TARGET static Lanes broadcast(const Limbs& limbs)
+    {
+        Lanes result;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            result.limbs[i] = broadcast(limbs[i]);
+        }
+        return result;
+    }
+
+    // Transpose 8 contiguous elements into words.
+    FIELD_LANES_TARGET static Words load(const Fr* src)
+    {
+        const auto* data = reinterpret_cast<const __m512i*>(src);
+        // Each register holds 2 elements: gather words 0 and 1, and words 2 and 3, of 4 elements, then combine halves.
+        const __m512i low_words = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+        const __m512i high_words = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+        const __m512i low_halves = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+        const __m512i high_halves = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+        const __m512i r0 = _mm512_loadu_si512(data);
+        const __m512i r1 = _mm512_loadu_si512(data + 1);
+        const __m512i r2 = _mm512_loadu_si512(data + 2);
+        const __m512i r3 = _mm512_loadu_si512(data + 3);
+        const __m512i t0 = _mm512_permutex2var_epi64(r0, low_words, r1);
+        const __m512i t1 = _mm512_permutex2var_epi64(r0, high_words, r1);
+        const __m512i t2 = _mm512_permutex2var_epi64(r2, low_words, r3);
+        const __m512i t3 = _mm512_permutex2var_epi64(r2, high_words, r3);
+        return { { _mm512_permutex2var_epi64(t0, low_halves, t2),
+                   _mm512_permutex2var_epi64(t0, high_halves, t2),
+                   _mm512_permutex2var_epi64(t1, low_halves, t3),
+                   _mm512_permutex2var_epi64(t1, high_halves, t3) } };
+    }
+
+    // The inverse of load.
+    FIELD_LANES_TARGET static void store(const Words& words, Fr* dst)
+    {
+        auto* data = reinterpret_cast<__m512i*>(dst);
+        const __m512i low_halves = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+        const __m512i high_halves = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+        const __m512i interleave_low = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+        const __m512i interleave_high = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+        const __m512i t0 = _mm512_permutex2var_epi64(words[0], low_halves, words[1]);
+        const __m512i t1 = _mm512_permutex2var_epi64(words[2], low_halves, words[3]);
+        const __m512i t2 = _mm512_permutex2var_epi64(words[0], high_halves, words[1]);
+        const __m512i t3 = _mm512_permutex2var_epi64(words[2], high_halves, words[3]);
+        _mm512_storeu_si512(data, _mm512_permutex2var_epi64(t0, interleave_low, t1));
+        _mm512_storeu_si512(data + 1, _mm512_permutex2var_epi64(t0, interleave_high, t1));
+        _mm512_storeu_si512(data + 2, _mm512_permutex2var_epi64(t2, interleave_low, t3));
+        _mm512_storeu_si512(data + 3, _mm512_permutex2var_epi64(t2, interleave_high, t3));
+    }
+
+    FIELD_LANES_TARGET static Lanes to_lanes(const Words& w)
+    {
+        const __m512i mask = broadcast(LIMB_MASK);
+        return { { _mm512_and_si512(w[0], mask),
+                   _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(w[0], 52), _mm512_slli_epi64(w[1], 12)), mask),
+                   _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(w[1], 40), _mm512_slli_epi64(w[2], 24)), mask),
+                   _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(w[2], 28), _mm512_slli_epi64(w[3], 36)), mask),
+                   _mm512_srli_epi64(w[3], 16) } };
+    }
+
+    FIELD_LANES_TARGET static Lanes to_lanes_times_16(const Words& w)
+    {
+        const __m512i mask = broadcast(LIMB_MASK);
+        return { { _mm512_and_si512(_mm512_slli_epi64(w[0], 4), mask),
+                   _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(w[0], 48), _mm512_slli_epi64(w[1], 16)), mask),
+                   _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(w[1], 36), _mm512_slli_epi64(w[2], 28)), mask),
+                   _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(w[2], 24), _mm512_slli_epi64(w[3], 40)), mask),
+                   _mm512_srli_epi64(w[3], 12) } };
+    }
+
+    // For normalized lanes below 2^256.
+    FIELD_LANES_TARGET static Words to_words(const Lanes& x)
+    {
+        const auto& l = x.limbs;
+        return { { _mm512_or_si512(l[0], _mm512_slli_epi64(l[1], 52)),
+                   _mm512_or_si512(_mm512_srli_epi64(l[1], 12), _mm512_slli_epi64(l[2], 40)),
+                   _mm512_or_si512(_mm512_srli_epi64(l[2], 24), _mm512_slli_epi64(l[3], 28)),
+                   _mm512_or_si512(_mm512_srli_epi64(l[3], 36), _mm512_slli_epi64(l[4], 16)) } };
+    }
+
+    // Carry each limb into the next, leaving every limb below 2^52 but the last.
+    FIELD_LANES_TARGET static void normalize(__m512i* t)
+    {
+        const __m512i mask = broadcast(LIMB_MASK);
+        for (size_t i = 0; i + 1 < NUM_LIMBS; ++i) {
+            t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], 52));
+            t[i] = _mm512_and_si512(t[i], mask);
+        }
+    }
+
+    // x - q in the lanes where x >= q, x elsewhere, for normalized x.
+    FIELD_LANES_TARGET static Lanes subtract_if_not_less(const Lanes& x, const Limbs& q)
+    {
+        const __m512i mask = broadcast(LIMB_MASK);
+        Lanes difference;
+        __m512i borrow = _mm512_setzero_si512();
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            const __m512i d = _mm512_sub_epi64(_mm512_sub_epi64(x.limbs[i], broadcast(q[i])), borrow);
+            borrow = _mm512_srli_epi64(d, 63);
+            difference.limbs[i] = _mm512_and_si512(d, mask);
+        }
+        const __mmask8 not_less = _mm512_cmpeq_epi64_mask(borrow, _mm512_setzero_si512());
+        Lanes result;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            result.limbs[i] = _mm512_mask_blend_epi64(not_less, x.limbs[i], difference.limbs[i]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Montgomery product a * b / 2^260, for a given as 16 times a coarse element and b a coarse element: the
+     * field product, fully reduced.
+     *
+     * @details Operand scanning over the limbs of b. The accumulator limbs are only carried at the end: each round adds
+     * less than 2^54 to a limb, so they stay far below 2^64. The result is below 32p * 2p / 2^260 + p < 2p, as
+     * p < 2^254, so one subtraction reduces it.
+     */
+    FIELD_LANES_TARGET static Lanes mont_mul(const Lanes& a, const Lanes& b)
+    {
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i modulus_inv = broadcast(MODULUS_INV);
+        __m512i t[NUM_LIMBS + 1];
+        for (auto& limb : t) {
+            limb = zero;
+        }
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                t[j] = _mm512_madd52lo_epu64(t[j], a.limbs[j], b.limbs[i]);
+                t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a.limbs[j], b.limbs[i]);
+            }
+            const __m512i m = _mm512_madd52lo_epu64(zero, t[0], modulus_inv);
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                const __m512i p = broadcast(MODULUS[j]);
+                t[j] = _mm512_madd52lo_epu64(t[j], p, m);
+                t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], p, m);
+            }
+            // The low 52 bits of t[0] are now zero: divide by 2^52.
+            t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                t[j] = t[j + 1];
+            }
+            t[NUM_LIMBS] = zero;
+        }
+        Lanes result;
+        std::copy_n(t, NUM_LIMBS, result.limbs);
+        normalize(result.limbs);
+        return subtract_if_not_less(result, MODULUS);
+    }
+
+    FIELD_LANES_TARGET static Lanes add(const Lanes& x, const Lanes& y)
+    {
+        Lanes result;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            result.limbs[i] = _mm512_add_epi64(x.limbs[i], y.limbs[i]);
+        }
+        normalize(result.limbs);
+        return result;
+    }
+
+    // x - y, plus 2p if that is negative: below 2p for x and y below 2p.
+    FIELD_LANES_TARGET static Lanes sub(const Lanes& x, const Lanes& y)
+    {
+        static constexpr Limbs TWICE_MODULUS = shift_limbs(MODULUS, 1);
+        const __m512i mask = broadcast(LIMB_MASK);
+        Lanes result;
+        __m512i borrow = _mm512_setzero_si512();
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            const __m512i d = _mm512_sub_epi64(_mm512_sub_epi64(x.limbs[i], y.limbs[i]), borrow);
+            borrow = _mm512_srli_epi64(d, 63);
+            result.limbs[i] = _mm512_and_si512(d, mask);
+        }
+        // Negative differences have wrapped around 2^260, which the top limb mask takes back off after adding 2p.
+        const __mmask8 negative = _mm512_cmpneq_epi64_mask(borrow, _mm512_setzero_si512());
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            const __m512i correction = _mm512_maskz_mov_epi64(negative, broadcast(TWICE_MODULUS[i]));
+            result.limbs[i] = _mm512_add_epi64(result.limbs[i], correction);
+        }
+        normalize(result.limbs);
+        result.limbs[NUM_LIMBS - 1] = _mm512_and_si512(result.limbs[NUM_LIMBS - 1], mask);
+        return result;
+    }
+
+    static Limbs scalar_limbs_times_16(const Fr& scalar) { return to_limbs_times_16(scalar.data); }
+
+    FIELD_LANES_TARGET static void mul(const Fr* a, const Fr* b, Fr* result, const size_t n)
+    {
+        const size_t num_vectors = n / NUM_LANES;
+        for (size_t v = 0; v < num_vectors; ++v) {
+            const size_t offset = v * NUM_LANES;
+            const Lanes x = to_lanes_times_16(load(a + offset));
+            const Lanes y = to_lanes(load(b + offset));
+            store(to_words(mont_mul(x, y)), result + offset);
+        }
+        for (size_t i = num_vectors * NUM_LANES; i < n; ++i) {
+            result[i] = a[i] * b[i];
+        }
+    }
+
+    FIELD_LANES_TARGET static void mul_by_scalar(const Fr* a, const Fr& scalar, Fr* result, const size_t n)
+    {
+        const Lanes s = broadcast(scalar_limbs_times_16(scalar));
+        const size_t num_vectors = n / NUM_LANES;
+        for (size_t v = 0; v < num_vectors; ++v) {
+            const size_t offset = v * NUM_LANES;
+            store(to_words(mont_mul(s, to_lanes(load(a + offset)))), result + offset);
+        }
+        for (size_t i = num_vectors * NUM_LANES; i < n; ++i) {
+            result[i] = a[i] * scalar;
+        }
+    }
+
+    FIELD_LANES_TARGET static void interpolate_pairs(const Fr* pairs, const Fr& challenge, Fr* result, const size_t n)
+    {
+        static constexpr Limbs TWICE_MODULUS = shift_limbs(MODULUS, 1);
+        const Lanes u = broadcast(scalar_limbs_times_16(challenge));
+        const __m512i even = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+        const __m512i odd = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+        const size_t num_vectors = n / NUM_LANES;
+        // All of a vector's inputs are read before its outputs are written, and the outputs are behind the inputs
+        // still to be read, so the result can overwrite the pairs.
+        for (size_t v = 0; v < num_vectors; ++v) {
+            const size_t offset = v * NUM_LANES;
+            const Words first = load(pairs + 2 * offset);
+            const Words second = load(pairs + 2 * offset + NUM_LANES);
+            Words left;
+            Words right;
+            for (size_t w = 0; w < 4; ++w) {
+                left[w] = _mm512_permutex2var_epi64(first[w], even, second[w]);
+                right[w] = _mm512_permutex2var_epi64(first[w], odd, second[w]);
+            }
+            const Lanes x = to_lanes(left);
+            // x + u (y - x) is below p + 2p, and back below 2p after subtracting 2p if not already.
+            const Lanes sum = add(x, mont_mul(u, sub(to_lanes(right), x)));
+            store(to_words(subtract_if_not_less(sum, TWICE_MODULUS)), result + offset);
+        }
+        for (size_t i = num_vectors * NUM_LANES; i < n; ++i) {
+            result[i] = pairs[2 * i] + challenge * (pairs[2 * i + 1] - pairs[2 * i]);
+        }
+    }
+
+    FIELD_LANES_TARGET static void prefix_product(Fr* a, const size_t n)
+    {
+        // Lane k keeps the running product of the k'th of 8 runs of run_length elements.
+        const size_t run_length = n / NUM_LANES;
+        alignas(64) std::array<Fr, NUM_LANES> column;
+        for (size_t k = 0; k < NUM_LANES; ++k) {
+            column[k] = a[k * run_length];
+        }
+        Lanes product = to_lanes(load(column.data()));
+        for (size_t i = 1; i < run_length; ++i) {
+            for (size_t k = 0; k < NUM_LANES; ++k) {
+                column[k] = a[k * run_length + i];
+            }
+            product = mont_mul(to_lanes_times_16(load(column.data())), product);
+            store(to_words(product), column.data());
+            for (size_t k = 0; k < NUM_LANES; ++k) {
+                a[k * run_length + i] = column[k];
+            }
+        }
+        // Scale each run by the products of the runs before it.
+        Fr run_scale = a[run_length - 1];
+        for (size_t k = 1; k < NUM_LANES; ++k) {
+            Fr* run = a + k * run_length;
+            const Fr next_run_scale = run_scale * run[run_length - 1];
+            mul_by_scalar(run, run_scale, run, run_length);
+            run_scale = next_run_scale;
+        }
+        for (size_t i = NUM_LANES * run_length; i < n; ++i) {
+            a[i] *= a[i - 1];
+        }
+    }
+
+    FIELD_LANES_TARGET static void barycentric_extend(const Fr* values,
+                                                      const size_t num_values,
+                                                      const Fr* weights,
+                                                      const Fr* scales,
+                                                      Fr* result,
+                                                      const size_t num_results)
+    {
+        if (num_values > (1UL << MAX_SUM_LOG2)) {
+            for (size_t k = 0; k < num_results; ++k) {
+                Fr sum = 0;
+                for (size_t j = 0; j < num_values; ++j) {
+                    sum += values[j] * weights[k * num_values + j];
+                }
+                result[k] = sum * scales[k];
+            }
+            return;
+        }
+        // Lane k evaluates at the k'th new point of the group, unused lanes at the group's first.
+        alignas(64) std::array<Fr, NUM_LANES> column;
+        for (size_t group = 0; group < num_results; group += NUM_LANES) {
+            const size_t group_size = std::min(NUM_LANES, num_results - group);
+            Lanes sum;
+            for (auto& limb : sum.limbs) {
+                limb = _mm512_setzero_si512();
+            }
+            for (size_t j = 0; j < num_values; ++j) {
+                for (size_t k = 0; k < NUM_LANES; ++k) {
+                    column[k] = weights[(group + (k < group_size ? k : 0)) * num_values + j];
+                }
+                const Lanes term = mont_mul(broadcast(scalar_limbs_times_16(values[j])), to_lanes(load(column.data())));
+                // Reduced terms: the limbs can take 2^MAX_SUM_LOG2 of them before a carry.
+                for (size_t i = 0; i < NUM_LIMBS; ++i) {
+                    sum.limbs[i] = _mm512_add_epi64(sum.limbs[i], term.limbs[i]);
+                }
+            }
+            normalize(sum.limbs);
+            for (size_t shift = MAX_SUM_LOG2; shift-- > 0;) {
+                sum = subtract_if_not_less(sum, shift_limbs(MODULUS, shift));
+            }
+            for (size_t k = 0; k < NUM_LANES; ++k) {
+                column[k] = scales[group + (k < group_size ? k : 0)];
+            }
+            store(to_words(mont_mul(to_lanes_times_16(load(column.data())), sum)), column.data());
+            std::copy_n(column.begin(), group_size, result + group);
+        }
+    }
+};
+
+} // namespace
+#endif
+
+namespace detail {
+
+#ifdef FIELD_LANES_X64
+#define FIELD_LANES_KERNEL(name, ...) Kernels<typename Fr::Params>::name(__VA_ARGS__)
+#else
+// use_vector_kernels is false without the x64 kernels, so these are never called.
+template <typename... Args> void no_vector_kernels(const Args&... /*unused*/)
+{
+    throw_or_abort("field_lanes: no vector kernels on this platform");
+}
+#define FIELD_LANES_KERNEL(name, ...) no_vector_kernels(__VA_ARGS__)
+#endif
+
+template <typename Fr> void mul(const Fr* a, const Fr* b, Fr* result, const size_t n)
+{
+    FIELD_LANES_KERNEL(mul, a, b, result, n);
+}
+
+template <typename Fr> void mul_by_scalar(const Fr* a, const Fr& scalar, Fr* result, const size_t n)
+{
+    FIELD_LANES_KERNEL(mul_by_scalar, a, scalar, result, n);
+}
+
+template <typename Fr> void interpolate_pairs(const Fr* pairs, const Fr& challenge, Fr* result, const size_t n)
+{
+    FIELD_LANES_KERNEL(interpolate_pairs, pairs, challenge, result, n);
+}
+
+template <typename Fr> void prefix_product(Fr* a, const size_t n)
+{
+    FIELD_LANES_KERNEL(prefix_product, a, n);
+}
+
+template <typename Fr>
+void barycentric_extend(const Fr* values,
+                        const size_t num_values,
+                        const Fr* weights,
+                        const Fr* scales,
+                        Fr* result,
+                        const size_t num_results)
+{
+    FIELD_LANES_KERNEL(barycentric_extend, values, num_values, weights, scales, result, num_results);
+}
+
+#undef FIELD_LANES_KERNEL
+
+#define INSTANTIATE_FIELD_LANES(Fr)                                                                                    \
+    template void mul<Fr>(const Fr*, const Fr*, Fr*, size_t);                                                          \
+    template void mul_by_scalar<Fr>(const Fr*, const Fr&, Fr*, size_t);                                               \
+    template void interpolate_pairs<Fr>(const Fr*, const Fr&, Fr*, size_t);                                           \
+    template void prefix_product<Fr>(Fr*, size_t);                                                                     \
+    template void barycentric_extend<Fr>(const Fr*, size_t, const Fr*, const Fr*, Fr*, size_t);
+
+INSTANTIATE_FIELD_LANES(barretenberg::fr)
+INSTANTIATE_FIELD_LANES(barretenberg::fq)
+
+} // namespace detail
+} // namespace barretenberg::field_lanes
@@ -0,0 +1,155 @@
+#pragma once
+#include "field.hpp"
+#include <cstddef>
+
+/**
+ * Batched field arithmetic over arrays of field elements, for loops that do the same operation on many elements.
+ *
+ * Each kernel has a vector implementation that works on 8 elements at once with AVX-512 IFMA (52-bit multiply-add
+ * over 5 limbs per element), picked at runtime on CPUs that have it. Everywhere else, and for fields without a vector
+ * implementation, the kernels are plain loops over the scalar field arithmetic. Both give the same field elements,
+ * though not necessarily the same (coarse) representations of them.
+ *
+ * AVX2 has no 52-bit multiply: a 4-lane 32-bit-limb Montgomery multiplication takes about as long as the scalar
+ * mulx/adx one, so AVX2-only CPUs use the scalar path.
+ */
+namespace barretenberg {
+class Bn254FrParams;
+class Bn254FqParams;
+} // namespace barretenberg
+
+namespace barretenberg::field_lanes {
+
+// Fields with a vector implementation (instantiated in field_lanes.cpp).
+template <typename Fr> inline constexpr bool has_vector_kernels = false;
+template <> inline constexpr bool has_vector_kernels<field<Bn254FrParams>> = true;
+template <> inline constexpr bool has_vector_kernels<field<Bn254FqParams>> = true;
+
+// Elements per vector.
+constexpr size_t NUM_LANES = 8;
+
+/**
+ * @brief Whether this CPU has the instructions the vector kernels need.
+ */
+bool is_supported();
+
+/**
+ * @brief Whether the vector kernels run: the CPU supports them and they have not been disabled.
+ */
+bool is_available();
+
+/**
+ * @brief Turn the vector kernels off (or back on, where supported), e.g. to test or benchmark the scalar path on a CPU
+ * that has them.
+ */
+void set_vector_kernels_enabled(bool enabled);
+
+namespace detail {
+template <typename Fr> void mul(const Fr* a, const Fr* b, Fr* result, size_t n);
+template <typename Fr> void mul_by_scalar(const Fr* a, const Fr& scalar, Fr* result, size_t n);
+template <typename Fr> void interpolate_pairs(const Fr* pairs, const Fr& challenge, Fr* result, size_t n);
+template <typename Fr> void prefix_product(Fr* a, size_t n);
+template <typename Fr>
+void barycentric_extend(
+    const Fr* values, size_t num_values, const Fr* weights, const Fr* scales, Fr* result, size_t num_results);
+} // namespace detail
+
+template <typename Fr> bool use_vector_kernels(const size_t n)
+{
+    if constexpr (has_vector_kernels<Fr>) {
+        return n >= NUM_LANES && is_available();
+    } else {
+        static_cast<void>(n);
+        return false;
+    }
+}
+
+/**
+ * @brief result[i] = a[i] * b[i]. result may be a or b.
+ */
+template <typename Fr> void mul(const Fr* a, const Fr* b, Fr* result, const size_t n)
+{
+    if (use_vector_kernels<Fr>(n)) {
+        detail::mul(a, b, result, n);
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        result[i] = a[i] * b[i];
+    }
+}
+
+/**
+ * @brief result[i] = a[i] * scalar. result may be a.
+ */
+template <typename Fr> void mul_by_scalar(const Fr* a, const Fr& scalar, Fr* result, const size_t n)
+{
+    if (use_vector_kernels<Fr>(n)) {
+        detail::mul_by_scalar(a, scalar, result, n);
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        result[i] = a[i] * scalar;
+    }
+}
+
+/**
+ * @brief result[i] = pairs[2i] + challenge * (pairs[2i + 1] - pairs[2i]), the multilinear partial evaluation of
+ * sumcheck. result may be pairs.
+ */
+template <typename Fr> void interpolate_pairs(const Fr* pairs, const Fr& challenge, Fr* result, const size_t n)
+{
+    if (use_vector_kernels<Fr>(n)) {
+        detail::interpolate_pairs(pairs, challenge, result, n);
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        result[i] = pairs[2 * i] + challenge * (pairs[2 * i + 1] - pairs[2 * i]);
+    }
+}
+
+/**
+ * @brief a[i] = a[0] * a[1] * ... * a[i].
+ *
+ * @details The vector kernel runs 8 running products over 8 runs of the array side by side, then scales each run by
+ * the product of the runs before it.
+ */
+template <typename Fr> void prefix_product(Fr* a, const size_t n)
+{
+    if (use_vector_kernels<Fr>(n)) {
+        detail::prefix_product(a, n);
+        return;
+    }
+    for (size_t i = 1; i < n; ++i) {
+        a[i] *= a[i - 1];
+    }
+}
+
+/**
+ * @brief result[k] = scales[k] * sum_j values[j] * weights[k * num_values + j], for k < num_results: the barycentric
+ * evaluation of a univariate at num_results new points.
+ *
+ * @details The vector kernel puts one new point in each lane, so it only pays off with at least half a vector of
+ * them.
+ */
+template <typename Fr>
+void barycentric_extend(const Fr* values,
+                        const size_t num_values,
+                        const Fr* weights,
+                        const Fr* scales,
+                        Fr* result,
+                        const size_t num_results)
+{
+    if (use_vector_kernels<Fr>(2 * num_results)) {
+        detail::barycentric_extend(values, num_values, weights, scales, result, num_results);
+        return;
+    }
+    for (size_t k = 0; k < num_results; ++k) {
+        Fr sum = 0;
+        for (size_t j = 0; j < num_values; ++j) {
+            sum += values[j] * weights[k * num_values + j];
+        }
+        result[k] = sum * scales[k];
+    }
+}
+
+} // namespace barretenberg::field_lanes
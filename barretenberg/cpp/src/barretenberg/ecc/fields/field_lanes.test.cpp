@@ -0,0 +1,134 @@
+#include "field_lanes.hpp"
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace barretenberg;
+
+namespace {
+
+// Random elements, every other one in the coarse form a + p where that is below 2p.
+template <typename Fr> std::vector<Fr> random_elements(const size_t n)
+{
+    std::vector<Fr> result(n);
+    for (size_t i = 0; i < n; ++i) {
+        result[i] = Fr::random_element();
+        const uint256_t coarse = uint256_t(result[i]) + Fr::modulus;
+        if (i % 2 == 1 && coarse < Fr::modulus + Fr::modulus) {
+            result[i].data[0] = coarse.data[0];
+            result[i].data[1] = coarse.data[1];
+            result[i].data[2] = coarse.data[2];
+            result[i].data[3] = coarse.data[3];
+        }
+    }
+    return result;
+}
+
+// Sizes around the vector width, to cover the scalar tails.
+const std::vector<size_t> sizes = { 0, 1, 7, 8, 9, 17, 64, 101 };
+
+// Runs a test on the vector kernels or on the scalar loops.
+template <typename Fr_, bool VECTOR> struct Dispatch {
+    using Fr = Fr_;
+    static constexpr bool vector = VECTOR;
+};
+
+template <typename Dispatch> class FieldLanesTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        if (Dispatch::vector && !field_lanes::is_supported()) {
+            GTEST_SKIP() << "this CPU has no AVX-512 IFMA, so the vector kernels are not tested";
+        }
+        field_lanes::set_vector_kernels_enabled(Dispatch::vector);
+        ASSERT_EQ(field_lanes::use_vector_kernels<typename Dispatch::Fr>(field_lanes::NUM_LANES), Dispatch::vector);
+    }
+
+    void TearDown() override { field_lanes::set_vector_kernels_enabled(true); }
+};
+
+using FieldTypes = ::testing::Types<Dispatch<fr, true>, Dispatch<fq, true>, Dispatch<fr, false>, Dispatch<fq, false>>;
+
+} // namespace
+
+TYPED_TEST_SUITE(FieldLanesTest, FieldTypes);
+
+TYPED_TEST(FieldLanesTest, Mul)
+{
+    using Fr = typename TypeParam::Fr;
+    for (const size_t n : sizes) {
+        auto a = random_elements<Fr>(n);
+        auto b = random_elements<Fr>(n);
+        std::vector<Fr> result(n);
+        field_lanes::mul(a.data(), b.data(), result.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], a[i] * b[i]);
+        }
+        const Fr scalar = Fr::random_element();
+        field_lanes::mul_by_scalar(a.data(), scalar, result.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], a[i] * scalar);
+        }
+    }
+}
+
+TYPED_TEST(FieldLanesTest, InterpolatePairs)
+{
+    using Fr = typename TypeParam::Fr;
+    for (const size_t n : sizes) {
+        auto pairs = random_elements<Fr>(2 * n);
+        const Fr challenge = Fr::random_element();
+        std::vector<Fr> expected(n);
+        for (size_t i = 0; i < n; ++i) {
+            expected[i] = pairs[2 * i] + challenge * (pairs[2 * i + 1] - pairs[2 * i]);
+        }
+        std::vector<Fr> result(n);
+        field_lanes::interpolate_pairs(pairs.data(), challenge, result.data(), n);
+        // In place, as sumcheck does it.
+        field_lanes::interpolate_pairs(pairs.data(), challenge, pairs.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], expected[i]);
+            EXPECT_EQ(pairs[i], expected[i]);
+        }
+    }
+}
+
+TYPED_TEST(FieldLanesTest, PrefixProduct)
+{
+    using Fr = typename TypeParam::Fr;
+    for (const size_t n : sizes) {
+        auto a = random_elements<Fr>(n);
+        auto expected = a;
+        for (size_t i = 1; i < n; ++i) {
+            expected[i] *= expected[i - 1];
+        }
+        field_lanes::prefix_product(a.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(a[i], expected[i]);
+        }
+    }
+}
+
+TYPED_TEST(FieldLanesTest, BarycentricExtend)
+{
+    using Fr = typename TypeParam::Fr;
+    // Up to more values than the vector kernel sums before reducing, and more results than fit in a vector.
+    for (const size_t num_values : { 2UL, 5UL, 33UL }) {
+        for (const size_t num_results : { 1UL, 4UL, 13UL }) {
+            auto values = random_elements<Fr>(num_values);
+            auto weights = random_elements<Fr>(num_values * num_results);
+            auto scales = random_elements<Fr>(num_results);
+            std::vector<Fr> result(num_results);
+            field_lanes::barycentric_extend(
+                values.data(), num_values, weights.data(), scales.data(), result.data(), num_results);
+            for (size_t k = 0; k < num_results; ++k) {
+                Fr sum = 0;
+                for (size_t j = 0; j < num_values; ++j) {
+                    sum += values[j] * weights[k * num_values + j];
+                }
+                EXPECT_EQ(result[k], sum * scales[k]);
+            }
+        }
+    }
+}
@@ -0,0 +1,185 @@
+#include "./fixed_base_table.hpp"
+#include "./signed_digit_msm.hpp"
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/temp_file.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+
+namespace barretenberg::scalar_multiplication {
+
+namespace {
+
+// "BBFBTAB1": file format version 1. The header is followed by the table in memory layout (Montgomery form, native
+// byte order).
+constexpr uint64_t FIXED_BASE_TABLE_MAGIC = 0x3142415442464242ULL;
+// The endomorphism halves of a scalar have at most 128 bits.
+constexpr size_t FIXED_BASE_SCALAR_BITS = 128;
+// Points built per task, small enough that the projective multiples of a chunk stay in cache.
+constexpr size_t BUILD_CHUNK_SIZE = 1024;
+
+struct FixedBaseTableHeader {
+    uint64_t magic;
+    uint64_t num_points;
+    uint64_t window_bits;
+};
+
+} // namespace
+
+template <typename Curve>
+FixedBaseTable<Curve>::FixedBaseTable(const size_t num_points, const size_t window_bits)
+    : num_points(num_points)
+    , window_bits(window_bits)
+    , num_windows(get_num_windows(window_bits))
+    , table(static_cast<AffineElement*>(aligned_alloc(64, get_table_size(num_points, window_bits))), &aligned_free)
+{}
+
+template <typename Curve>
+FixedBaseTable<Curve>::FixedBaseTable(const AffineElement* point_table,
+                                      const size_t num_points,
+                                      const size_t window_bits)
+    : FixedBaseTable(num_points, window_bits)
+{
+    using Fq = typename Curve::BaseField;
+
+    const size_t stride = 2 * num_points;
+    const Fq beta = Fq::cube_root_of_unity();
+    const size_t num_chunks = (num_points + BUILD_CHUNK_SIZE - 1) / BUILD_CHUNK_SIZE;
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = chunk * BUILD_CHUNK_SIZE;
+        const size_t end = std::min(start + BUILD_CHUNK_SIZE, num_points);
+        std::copy(point_table + 2 * start, point_table + 2 * end, table.get() + 2 * start);
+        std::vector<Element> multiples(end - start);
+        for (size_t i = start; i < end; ++i) {
+            multiples[i - start] = Element(point_table[2 * i]);
+        }
+        // 2^{jc} \lambda P is the endomorphism image of 2^{jc} P, so only the P_i need doubling.
+        for (size_t window = 1; window < num_windows; ++window) {
+            for (auto& multiple : multiples) {
+                for (size_t i = 0; i < window_bits; ++i) {
+                    multiple.self_dbl();
+                }
+            }
+            Element::batch_normalize(multiples.data(), multiples.size());
+            AffineElement* window_table = &table[window * stride];
+            for (size_t i = start; i < end; ++i) {
+                const Element& multiple = multiples[i - start];
+                window_table[2 * i].x = multiple.x;
+                window_table[2 * i].y = multiple.y;
+                window_table[2 * i + 1].x = beta * multiple.x;
+                window_table[2 * i + 1].y = -multiple.y;
+            }
+        }
+    });
+}
+
+template <typename Curve> size_t FixedBaseTable<Curve>::get_num_windows(const size_t window_bits)
+{
+    // Booth recoding needs a zero bit above the top of the scalar, hence scalar_bits + 1.
+    return (FIXED_BASE_SCALAR_BITS + window_bits) / window_bits;
+}
+
+template <typename Curve>
+size_t FixedBaseTable<Curve>::get_table_size(const size_t num_points, const size_t window_bits)
+{
+    return get_num_windows(window_bits) * 2 * num_points * sizeof(AffineElement);
+}
+
+template <typename Curve>
+size_t FixedBaseTable<Curve>::get_window_bits(const size_t num_points, const size_t memory_budget)
+{
+    return get_fixed_base_window_bits(2 * num_points, FIXED_BASE_SCALAR_BITS, memory_budget / sizeof(AffineElement));
+}
+
+template <typename Curve>
+std::shared_ptr<FixedBaseTable<Curve>> FixedBaseTable<Curve>::read(const std::string& filename,
+                                                                   const AffineElement* point_table,
+                                                                   const size_t num_points)
+{
+    std::ifstream file(filename, std::ios::binary);
+    FixedBaseTableHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != FIXED_BASE_TABLE_MAGIC || num_points == 0 || header.num_points != num_points ||
+        header.window_bits == 0 || header.window_bits > FIXED_BASE_SCALAR_BITS) {
+        return nullptr;
+    }
+    const size_t window_bits = header.window_bits;
+    // Not make_shared: the constructor that leaves the table uninitialised is private.
+    std::shared_ptr<FixedBaseTable> result(new FixedBaseTable(num_points, window_bits));
+    file.read(reinterpret_cast<char*>(result->table.get()),
+              static_cast<std::streamsize>(get_table_size(num_points, window_bits)));
+    if (!file) {
+        return nullptr;
+    }
+
+    const AffineElement* table = result->table.get();
+    for (size_t k = 0; k < 2 * num_points; ++k) {
+        if (table[k].x != point_table[k].x || table[k].y != point_table[k].y) {
+            return nullptr;
+        }
+    }
+    const size_t stride = 2 * num_points;
+    const std::array<size_t, 3> samples{ 0, num_points / 2, num_points - 1 };
+    for (const size_t i : samples) {
+        Element multiple(point_table[2 * i]);
+        for (size_t window = 1; window < result->num_windows; ++window) {
+            for (size_t j = 0; j < window_bits; ++j) {
+                multiple.self_dbl();
+            }
+            const AffineElement expected(multiple);
+            const AffineElement& entry = table[window * stride + 2 * i];
+            if (entry.x != expected.x || entry.y != expected.y) {
+                return nullptr;
+            }
+        }
+    }
+    return result;
+}
+
+template <typename Curve> bool FixedBaseTable<Curve>::write(const std::string& filename) const
+{
+    const std::string temp_filename = unique_temp_filename(filename);
+    {
+        std::ofstream file(temp_filename, std::ios::binary | std::ios::trunc);
+        const FixedBaseTableHeader header{ FIXED_BASE_TABLE_MAGIC, num_points, window_bits };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(table.get()),
+                   static_cast<std::streamsize>(get_table_size(num_points, window_bits)));
+        if (!file) {
+            std::remove(temp_filename.c_str());
+            return false;
+        }
+    }
+    return std::rename(temp_filename.c_str(), filename.c_str()) == 0;
+}
+
+template <typename Curve> typename Curve::Element FixedBaseTable<Curve>::msm(std::span<const Fr> scalars) const
+{
+    const std::array<std::span<const Fr>, 1> batch{ scalars };
+    return batch_msm(batch)[0];
+}
+
+template <typename Curve>
+std::vector<typename Curve::Element> FixedBaseTable<Curve>::batch_msm(
+    std::span<const std::span<const Fr>> scalars) const
+{
+    // The table has no entries past num_points, so a longer MSM would read past the end of every window.
+    for (const auto& msm_scalars : scalars) {
+        if (msm_scalars.size() > num_points) {
+            throw_or_abort(format("MSM of ", msm_scalars.size(), " scalars over a table of ", num_points, " points."));
+        }
+    }
+    return pippenger_signed_digit_fixed_base_batch_unsafe<Curve>(scalars, table.get(), 2 * num_points, window_bits);
+}
+
+template class FixedBaseTable<curve::BN254>;
+template class FixedBaseTable<curve::Grumpkin>;
+
+} // namespace barretenberg::scalar_multiplication
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace barretenberg::scalar_multiplication {
+
+/**
+ * Per-window multiples of a fixed set of base points, for MSMs without doublings.
+ *
+ * Built over a pippenger point table [P_0, \lambda P_0, P_1, \lambda P_1, ...] of 2n points. Window j holds
+ * 2^{jc} times each of those points, for c = window_bits and every window a 128-bit endomorphism half can have. A
+ * signed digit d of window j is then just d times a table point, so an MSM is a bucket sort of table points plus the
+ * bucket sums, with no doublings (see fixed_base_signed_digit_msm).
+ *
+ * The table costs (128 + c) / c times the memory of the point table, so c is picked to fit a memory budget
+ * (`get_window_bits`). A table only depends on the base points, so it can be written next to the CRS and read back by
+ * the next process instead of being rebuilt.
+ */
+template <typename Curve> class FixedBaseTable {
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    /**
+     * @brief Build the table for the n SRS points behind a pippenger point table of 2n points.
+     */
+    FixedBaseTable(const AffineElement* point_table, size_t num_points, size_t window_bits);
+
+    /**
+     * @brief Cheapest window width whose table for num_points SRS points fits in memory_budget bytes, or 0 if none
+     * does.
+     */
+    static size_t get_window_bits(size_t num_points, size_t memory_budget);
+
+    /**
+     * @brief Size in bytes of the table for num_points SRS points.
+     */
+    static size_t get_table_size(size_t num_points, size_t window_bits);
+
+    /**
+     * @brief Read a table written by `write`.
+     *
+     * @details Returns nullptr if the file is missing, was written for a different number of points or window width,
+     * or does not match point_table. Window 0 is compared in full against point_table and every other window is spot
+     * checked.
+     */
+    static std::shared_ptr<FixedBaseTable> read(const std::string& filename,
+                                                const AffineElement* point_table,
+                                                size_t num_points);
+
+    /**
+     * @brief Write the table to filename, via a temporary file so a concurrent reader never sees a partial table.
+     *
+     * @return false if the file could not be written
+     */
+    bool write(const std::string& filename) const;
+
+    /**
+     * @brief sum_i scalars[i] * P_i, for at most num_points scalars.
+     */
+    Element msm(std::span<const Fr> scalars) const;
+
+    /**
+     * @brief Several MSMs over the table in one set of bucket passes, see pippenger_signed_digit_batch_unsafe.
+     */
+    std::vector<Element> batch_msm(std::span<const std::span<const Fr>> scalars) const;
+
+    size_t get_num_points() const { return num_points; }
+    size_t get_window_bits() const { return window_bits; }
+
+  private:
+    FixedBaseTable(size_t num_points, size_t window_bits);
+
+    // Windows needed for a 128-bit endomorphism half.
+    static size_t get_num_windows(size_t window_bits);
+
+    size_t num_points;
+    size_t window_bits;
+    size_t num_windows;
+    // Window j, point k at table[j * 2 * num_points + k].
+    std::unique_ptr<AffineElement[], void (*)(void*)> table;
+};
+
+extern template class FixedBaseTable<curve::BN254>;
+extern template class FixedBaseTable<curve::Grumpkin>;
+
+} // namespace barretenberg::scalar_multiplication
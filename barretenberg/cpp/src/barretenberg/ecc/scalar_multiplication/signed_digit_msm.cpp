@@ -0,0 +1,725 @@
+#include "./signed_digit_msm.hpp"
+
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace barretenberg::scalar_multiplication {
+
+namespace {
+
+constexpr size_t MIN_WINDOW_BITS = 2;
+constexpr size_t MAX_WINDOW_BITS = 20;
+// Upper bound on the points held in buckets at once by a batched MSM (256MiB of BN254 affine points).
+constexpr size_t MAX_BATCH_POINTS = static_cast<size_t>(1) << 22;
+
+// Cost model weights, in units of one batch-affine point addition (~6 field multiplications).
+// Each non-empty bucket costs a mixed addition into the running sum plus a full addition into the accumulator.
+constexpr uint64_t BUCKET_COST = 4;
+// Each reduction level costs every thread two parallel_for barriers and its share of the batched inversion.
+constexpr uint64_t LEVEL_COST = 64;
+// Sorting a window walks a per-thread bucket histogram, a couple of cycles per entry.
+constexpr uint64_t HISTOGRAM_ENTRIES_PER_ADDITION = 64;
+
+/**
+ * @brief Read `num_bits` (at most 32) bits of a 128-bit scalar, starting at bit `start`. Bits past the top are zero.
+ */
+inline uint64_t get_scalar_bits(const uint64_t* limbs, size_t start, size_t num_bits)
+{
+    if (start >= 128) {
+        return 0;
+    }
+    const size_t limb = start >> 6;
+    const size_t shift = start & 63;
+    uint64_t bits = limbs[limb] >> shift;
+    if (limb == 0 && shift + num_bits > 64) {
+        bits |= limbs[1] << (64 - shift);
+    }
+    return bits & ((1ULL << num_bits) - 1);
+}
+
+/**
+ * @brief Booth-recoded signed digit `window` of a scalar: d = -b_{c-1} 2^{c-1} + sum_{i < c-1} b_i 2^i + b_{-1},
+ * where b_i are the bits of the window (b_{-1} is the top bit of the window below).
+ */
+inline int64_t get_signed_digit(const uint64_t* limbs, size_t window, size_t window_bits)
+{
+    const size_t start = window * window_bits;
+    const uint64_t bits = get_scalar_bits(limbs, start, window_bits);
+    const uint64_t borrow = start == 0 ? 0 : get_scalar_bits(limbs, start - 1, 1);
+    const uint64_t low_bits = bits & ((1ULL << (window_bits - 1)) - 1);
+    const uint64_t top_bit = bits >> (window_bits - 1);
+    return static_cast<int64_t>(low_bits + borrow) - static_cast<int64_t>(top_bit << (window_bits - 1));
+}
+
+template <typename Element> Element mul_by_small_scalar(const Element& point, uint64_t scalar)
+{
+    Element result;
+    result.self_set_infinity();
+    if (scalar == 0) {
+        return result;
+    }
+    for (size_t bit = numeric::get_msb(scalar) + 1; bit-- > 0;) {
+        result.self_dbl();
+        if (((scalar >> bit) & 1ULL) != 0) {
+            result += point;
+        }
+    }
+    return result;
+}
+
+/**
+ * The buckets of one window, laid out contiguously: bucket b holds points [offsets[b], offsets[b] + sizes[b]).
+ * thread_bucket_start partitions the buckets between threads so that each thread holds about the same number of
+ * points.
+ */
+template <typename Curve> struct BucketState {
+    using AffineElement = typename Curve::AffineElement;
+    using Fq = typename Curve::BaseField;
+
+    AffineElement* points;
+    Fq* scratch_space;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> sizes;
+    std::vector<size_t> thread_bucket_start;
+};
+
+/**
+ * @brief Add up the points in every bucket, leaving a single affine point at the start of each non-empty bucket.
+ *
+ * @details Each level adds adjacent pairs within every bucket, halving the bucket sizes. The additions of a level are
+ * independent so they can use the affine formula with a batched inversion. Rather than every thread doing its own
+ * inversion, each thread accumulates the product of its denominators, a single inversion of all the thread products is
+ * computed, and each thread then recovers the inverse of its own product from it.
+ */
+template <typename Curve> void reduce_buckets_batch_affine(BucketState<Curve>& state, size_t num_threads)
+{
+    using AffineElement = typename Curve::AffineElement;
+    using Fq = typename Curve::BaseField;
+
+    std::vector<Fq> thread_products(num_threads);
+    std::vector<Fq> thread_prefix_products(num_threads);
+    std::vector<size_t> thread_num_pairs(num_threads);
+    std::vector<uint32_t> thread_max_size(num_threads);
+
+    uint32_t max_size = *std::max_element(state.sizes.begin(), state.sizes.end());
+    while (max_size > 1) {
+        // Forward pass: prefix products of the denominators (x2 - x1).
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t first_bucket = state.thread_bucket_start[thread_idx];
+            const size_t end_bucket = state.thread_bucket_start[thread_idx + 1];
+            const size_t scratch_start = first_bucket < state.sizes.size() ? state.offsets[first_bucket] / 2 : 0;
+            size_t pair = scratch_start;
+            Fq accumulator = Fq::one();
+            for (size_t bucket = first_bucket; bucket < end_bucket; ++bucket) {
+                const AffineElement* bucket_points = &state.points[state.offsets[bucket]];
+                const size_t num_pairs = state.sizes[bucket] >> 1;
+                for (size_t k = 0; k < num_pairs; ++k) {
+                    accumulator *= (bucket_points[2 * k + 1].x - bucket_points[2 * k].x);
+                    state.scratch_space[pair++] = accumulator;
+                }
+            }
+            thread_products[thread_idx] = accumulator;
+            thread_num_pairs[thread_idx] = pair - scratch_start;
+        });
+
+        // The one inversion of this level, shared out between the threads.
+        Fq accumulator = Fq::one();
+        for (size_t i = 0; i < num_threads; ++i) {
+            thread_prefix_products[i] = accumulator;
+            accumulator *= thread_products[i];
+        }
+        if (accumulator.is_zero()) {
+            throw_or_abort("attempted to invert zero in reduce_buckets_batch_affine");
+        }
+        accumulator = accumulator.invert();
+        for (size_t i = num_threads - 1; i < num_threads; --i) {
+            const Fq thread_inverse = accumulator * thread_prefix_products[i];
+            accumulator *= thread_products[i];
+            thread_products[i] = thread_inverse;
+        }
+
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t first_bucket = state.thread_bucket_start[thread_idx];
+            const size_t end_bucket = state.thread_bucket_start[thread_idx + 1];
+            const size_t scratch_start = first_bucket < state.sizes.size() ? state.offsets[first_bucket] / 2 : 0;
+
+            // Backward pass: turn the prefix products into the slope of every pair.
+            Fq inverse = thread_products[thread_idx];
+            size_t pair = scratch_start + thread_num_pairs[thread_idx];
+            for (size_t bucket = end_bucket; bucket-- > first_bucket;) {
+                const AffineElement* bucket_points = &state.points[state.offsets[bucket]];
+                for (size_t k = state.sizes[bucket] >> 1; k-- > 0;) {
+                    --pair;
+                    const Fq denominator = bucket_points[2 * k + 1].x - bucket_points[2 * k].x;
+                    const Fq denominator_inverse =
+                        pair == scratch_start ? inverse : inverse * state.scratch_space[pair - 1];
+                    inverse *= denominator;
+                    state.scratch_space[pair] =
+                        (bucket_points[2 * k + 1].y - bucket_points[2 * k].y) * denominator_inverse;
+                }
+            }
+
+            // Forward again: apply the slopes. Pair k of a bucket is written to slot k, whose inputs (slots 2k, 2k + 1)
+            // are read first and which no later pair reads, so this can be done in place.
+            uint32_t max_thread_size = 0;
+            for (size_t bucket = first_bucket; bucket < end_bucket; ++bucket) {
+                AffineElement* bucket_points = &state.points[state.offsets[bucket]];
+                const uint32_t size = state.sizes[bucket];
+                const size_t num_pairs = size >> 1;
+                for (size_t k = 0; k < num_pairs; ++k) {
+                    const Fq& lambda = state.scratch_space[pair++];
+                    const Fq x1 = bucket_points[2 * k].x;
+                    const Fq y1 = bucket_points[2 * k].y;
+                    const Fq x3 = lambda.sqr() - (x1 + bucket_points[2 * k + 1].x);
+                    bucket_points[k].y = lambda * (x1 - x3) - y1;
+                    bucket_points[k].x = x3;
+                }
+                if ((size & 1U) != 0) {
+                    bucket_points[num_pairs] = bucket_points[size - 1];
+                }
+                state.sizes[bucket] = (size + 1) >> 1;
+                max_thread_size = std::max(max_thread_size, state.sizes[bucket]);
+            }
+            thread_max_size[thread_idx] = max_thread_size;
+        });
+        max_size = *std::max_element(thread_max_size.begin(), thread_max_size.end());
+    }
+}
+
+/**
+ * The scalars of one MSM, compacted by size. Zero scalars are dropped, scalars below 2^64 are kept whole (an
+ * endomorphism split would turn them into two ~128-bit halves) and the rest are split. Both lists keep the original
+ * order of their scalars, so the point accesses stay sequential.
+ */
+struct CompactedScalars {
+    // Two limbs per scalar and the index of its point P_i in the point table.
+    std::vector<uint64_t> small_limbs;
+    std::vector<uint32_t> small_indices;
+    size_t small_bits = 0;
+    // The halves k1, k2 of each large scalar and the indices of P_i, \lambda P_i. If no scalar was dropped or moved to
+    // the small list, big_indices is left empty: the indices are then just 0, 1, 2, ...
+    std::vector<uint64_t> big_limbs;
+    std::vector<uint32_t> big_indices;
+};
+
+template <typename Fr> CompactedScalars compact_scalars(std::span<const Fr> scalars)
+{
+    CompactedScalars result;
+    const size_t num_scalars = scalars.size();
+    if (num_scalars == 0) {
+        return result;
+    }
+    ASSERT(2 * num_scalars < (1ULL << 32));
+    const size_t num_threads = std::min(get_num_cpus(), num_scalars);
+    const size_t scalars_per_thread = (num_scalars + num_threads - 1) / num_threads;
+
+    // Count each thread's small and large scalars...
+    std::vector<size_t> thread_small_counts(num_threads + 1, 0);
+    std::vector<size_t> thread_big_counts(num_threads + 1, 0);
+    std::vector<size_t> thread_small_bits(num_threads, 0);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * scalars_per_thread, num_scalars);
+        const size_t end = std::min(start + scalars_per_thread, num_scalars);
+        for (size_t i = start; i < end; ++i) {
+            const Fr k = scalars[i].from_montgomery_form().reduce_once();
+            if ((k.data[1] | k.data[2] | k.data[3]) != 0) {
+                thread_big_counts[thread_idx + 1]++;
+            } else if (k.data[0] != 0) {
+                thread_small_counts[thread_idx + 1]++;
+                thread_small_bits[thread_idx] =
+                    std::max(thread_small_bits[thread_idx], static_cast<size_t>(numeric::get_msb(k.data[0])) + 1);
+            }
+        }
+    });
+    for (size_t i = 0; i < num_threads; ++i) {
+        thread_small_counts[i + 1] += thread_small_counts[i];
+        thread_big_counts[i + 1] += thread_big_counts[i];
+        result.small_bits = std::max(result.small_bits, thread_small_bits[i]);
+    }
+    const size_t num_small = thread_small_counts[num_threads];
+    const size_t num_big = thread_big_counts[num_threads];
+    const bool all_big = num_big == num_scalars;
+    result.small_limbs.resize(2 * num_small);
+    result.small_indices.resize(num_small);
+    result.big_limbs.resize(4 * num_big);
+    result.big_indices.resize(all_big ? 0 : 2 * num_big);
+
+    // ...then write them out in order.
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * scalars_per_thread, num_scalars);
+        const size_t end = std::min(start + scalars_per_thread, num_scalars);
+        size_t small = thread_small_counts[thread_idx];
+        size_t big = thread_big_counts[thread_idx];
+        for (size_t i = start; i < end; ++i) {
+            const Fr k = scalars[i].from_montgomery_form().reduce_once();
+            if ((k.data[1] | k.data[2] | k.data[3]) != 0) {
+                // Split k into k1 - \lambda k2 (see compute_wnaf_states). k1 multiplies points[2i] and k2 multiplies
+                // points[2i + 1] = -\lambda points[2i]. Both halves fit in 128 bits.
+                Fr k1;
+                Fr k2;
+                Fr::split_into_endomorphism_scalars(k, k1, k2);
+                result.big_limbs[4 * big] = k1.data[0];
+                result.big_limbs[4 * big + 1] = k1.data[1];
+                result.big_limbs[4 * big + 2] = k2.data[0];
+                result.big_limbs[4 * big + 3] = k2.data[1];
+                if (!all_big) {
+                    result.big_indices[2 * big] = static_cast<uint32_t>(2 * i);
+                    result.big_indices[2 * big + 1] = static_cast<uint32_t>(2 * i + 1);
+                }
+                ++big;
+            } else if (k.data[0] != 0) {
+                result.small_limbs[2 * small] = k.data[0];
+                result.small_limbs[2 * small + 1] = 0;
+                result.small_indices[small] = static_cast<uint32_t>(2 * i);
+                ++small;
+            }
+        }
+    });
+    return result;
+}
+
+} // namespace
+
+size_t get_signed_digit_window_bits(const size_t num_points,
+                                    const size_t scalar_bits,
+                                    const size_t num_threads,
+                                    const size_t num_msms)
+{
+    size_t best_bits = MIN_WINDOW_BITS;
+    uint64_t best_cost = std::numeric_limits<uint64_t>::max();
+    for (size_t bits = MIN_WINDOW_BITS; bits <= MAX_WINDOW_BITS; ++bits) {
+        const uint64_t num_windows = (scalar_bits + bits) / bits;
+        const uint64_t num_buckets = (1ULL << (bits - 1)) * num_msms;
+        const uint64_t points_per_bucket = std::max(static_cast<uint64_t>(num_points) / num_buckets, uint64_t(1));
+        const uint64_t num_levels = numeric::get_msb(points_per_bucket) + 1;
+        const uint64_t cost =
+            num_windows * (num_points + BUCKET_COST * num_buckets + LEVEL_COST * num_threads * num_levels +
+                           (num_buckets * num_threads) / HISTOGRAM_ENTRIES_PER_ADDITION);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_bits = bits;
+        }
+    }
+    return best_bits;
+}
+
+size_t get_fixed_base_window_bits(const size_t num_points, const size_t scalar_bits, const size_t max_table_points)
+{
+    size_t best_bits = 0;
+    uint64_t best_cost = std::numeric_limits<uint64_t>::max();
+    for (size_t bits = MIN_WINDOW_BITS; bits <= MAX_WINDOW_BITS; ++bits) {
+        const uint64_t num_windows = (scalar_bits + bits) / bits;
+        if (num_windows * num_points > max_table_points) {
+            continue;
+        }
+        // Every window of every point is one bucket addition; the buckets are summed once per pass rather than once
+        // per window (see accumulate_signed_digit_windows).
+        const uint64_t windows_per_pass =
+            std::clamp(MAX_BATCH_POINTS / std::max(num_points, size_t(1)), size_t(1), static_cast<size_t>(num_windows));
+        const uint64_t num_passes = (num_windows + windows_per_pass - 1) / windows_per_pass;
+        const uint64_t cost = num_windows * num_points + num_passes * BUCKET_COST * (1ULL << (bits - 1));
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_bits = bits;
+        }
+    }
+    return best_bits;
+}
+
+namespace {
+
+/**
+ * @brief The bucket passes shared by every entry point: add the signed-digit windows of each MSM into `results`.
+ *
+ * @details If fixed_base_stride is zero, digit j of a scalar multiplies its point and the windows are combined with
+ * doublings. Otherwise `points` is a fixed-base table whose window j (at offset j * fixed_base_stride) holds
+ * 2^{j * window_bits} times the base points, so every digit can go straight into the buckets.
+ */
+template <typename Curve>
+void accumulate_signed_digit_windows(const typename Curve::AffineElement* points,
+                                     std::span<const SignedDigitMsmInput> msms,
+                                     const size_t window_bits,
+                                     const size_t fixed_base_stride,
+                                     std::vector<typename Curve::Element>& results)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fq = typename Curve::BaseField;
+
+    const size_t num_msms = msms.size();
+    size_t max_num_points = 0;
+    size_t total_num_points = 0;
+    size_t scalar_bits = 1;
+    for (const auto& msm : msms) {
+        max_num_points = std::max(max_num_points, msm.num_points);
+        total_num_points += msm.num_points;
+        scalar_bits = std::max(scalar_bits, msm.scalar_bits);
+    }
+    if (total_num_points == 0) {
+        return;
+    }
+    const size_t num_threads = std::min(get_num_cpus(), max_num_points);
+    // Booth recoding needs a zero bit above the top of the scalar, hence scalar_bits + 1.
+    const size_t num_windows = (scalar_bits + window_bits) / window_bits;
+    const size_t num_msm_buckets = 1UL << (window_bits - 1);
+    // Bucket msm * num_msm_buckets + b holds the points of MSM `msm` whose digit is +-(b + 1).
+    const size_t num_buckets = num_msm_buckets * num_msms;
+    const size_t points_per_thread = (max_num_points + num_threads - 1) / num_threads;
+    // With a fixed-base table there is nothing to double, so windows can share buckets: each pass takes as many
+    // windows as fit in the bucket buffer.
+    const bool fixed_base = fixed_base_stride != 0;
+    const size_t windows_per_pass =
+        fixed_base ? std::clamp(MAX_BATCH_POINTS / total_num_points, size_t(1), num_windows) : 1;
+    const size_t num_passes = (num_windows + windows_per_pass - 1) / windows_per_pass;
+    const size_t max_bucket_points = total_num_points * windows_per_pass;
+    ASSERT(max_bucket_points < (1ULL << 32));
+
+    std::unique_ptr<AffineElement[], decltype(&aligned_free)> bucket_points(
+        static_cast<AffineElement*>(aligned_alloc(64, max_bucket_points * sizeof(AffineElement))), &aligned_free);
+    auto scratch_space_slab = get_mem_slab((max_bucket_points / 2 + 1) * sizeof(Fq));
+    BucketState<Curve> state{ bucket_points.get(),
+                              static_cast<Fq*>(scratch_space_slab.get()),
+                              std::vector<uint32_t>(num_buckets + 1),
+                              std::vector<uint32_t>(num_buckets),
+                              std::vector<size_t>(num_threads + 1) };
+    std::vector<uint32_t> thread_bucket_counts(num_threads * num_buckets);
+    std::vector<Element> thread_sums(num_threads * num_msms);
+
+    for (size_t pass = 0; pass < num_passes; ++pass) {
+        // Windows [first_window, end_window) go into the buckets this pass. Without a table, one window per pass, from
+        // the top down, with doublings in between (Horner).
+        const size_t first_window = fixed_base ? pass * windows_per_pass : num_windows - 1 - pass;
+        const size_t end_window =
+            fixed_base ? std::min(first_window + windows_per_pass, num_windows) : first_window + 1;
+        for (size_t i = 0; i < window_bits && !fixed_base && pass != 0; ++i) {
+            for (auto& result : results) {
+                result.self_dbl();
+            }
+        }
+
+        // Counting sort of the points into buckets by the absolute value of their digit. First count per thread...
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            uint32_t* counts = &thread_bucket_counts[thread_idx * num_buckets];
+            std::fill(counts, counts + num_buckets, 0U);
+            const size_t start = std::min(thread_idx * points_per_thread, max_num_points);
+            const size_t end = std::min(start + points_per_thread, max_num_points);
+            for (size_t msm = 0; msm < num_msms; ++msm) {
+                // Digit j only sees bits jc - 1 and up, so shorter scalars have nothing in the top windows.
+                const size_t msm_end_window = std::min(end_window, msms[msm].scalar_bits / window_bits + 1);
+                uint32_t* msm_counts = counts + msm * num_msm_buckets;
+                const uint64_t* scalar_limbs = msms[msm].scalar_limbs;
+                const size_t msm_end = std::min(end, msms[msm].num_points);
+                for (size_t i = start; i < msm_end; ++i) {
+                    for (size_t window = first_window; window < msm_end_window; ++window) {
+                        const int64_t digit = get_signed_digit(&scalar_limbs[2 * i], window, window_bits);
+                        if (digit != 0) {
+                            msm_counts[std::abs(digit) - 1]++;
+                        }
+                    }
+                }
+            }
+        });
+        // ...then turn the counts into each thread's starting position within each bucket...
+        const size_t buckets_per_thread = (num_buckets + num_threads - 1) / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = std::min(thread_idx * buckets_per_thread, num_buckets);
+            const size_t end = std::min(start + buckets_per_thread, num_buckets);
+            for (size_t bucket = start; bucket < end; ++bucket) {
+                uint32_t total = 0;
+                for (size_t i = 0; i < num_threads; ++i) {
+                    const uint32_t count = thread_bucket_counts[i * num_buckets + bucket];
+                    thread_bucket_counts[i * num_buckets + bucket] = total;
+                    total += count;
+                }
+                state.sizes[bucket] = total;
+            }
+        });
+        state.offsets[0] = 0;
+        for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+            state.offsets[bucket + 1] = state.offsets[bucket] + state.sizes[bucket];
+        }
+        const uint32_t num_bucket_points = state.offsets[num_buckets];
+        if (num_bucket_points == 0) {
+            continue;
+        }
+        // ...and scatter the (conditionally negated) points. Each thread writes its points in index order, so the
+        // layout, and therefore the result, does not depend on scheduling. Each thread walks its range of scalar
+        // indices for all of the MSMs at once, so a base point shared by several MSMs is loaded once.
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            uint32_t* positions = &thread_bucket_counts[thread_idx * num_buckets];
+            const size_t start = std::min(thread_idx * points_per_thread, max_num_points);
+            const size_t end = std::min(start + points_per_thread, max_num_points);
+            for (size_t i = start; i < end; ++i) {
+                for (size_t msm = 0; msm < num_msms; ++msm) {
+                    const auto& input = msms[msm];
+                    if (i >= input.num_points) {
+                        continue;
+                    }
+                    const size_t msm_end_window = std::min(end_window, input.scalar_bits / window_bits + 1);
+                    const size_t point_index = input.point_indices == nullptr ? i : input.point_indices[i];
+                    for (size_t window = first_window; window < msm_end_window; ++window) {
+                        const int64_t digit = get_signed_digit(&input.scalar_limbs[2 * i], window, window_bits);
+                        if (digit == 0) {
+                            continue;
+                        }
+                        // Window j of a fixed-base table holds 2^{jc} times the base points.
+                        const AffineElement& point =
+                            points[point_index + (fixed_base ? window * fixed_base_stride : 0)];
+                        const size_t bucket = msm * num_msm_buckets + static_cast<size_t>(std::abs(digit) - 1);
+                        AffineElement& target = state.points[state.offsets[bucket] + positions[bucket]++];
+                        target.x = point.x;
+                        target.y = digit < 0 ? -point.y : point.y;
+                    }
+                }
+            }
+        });
+
+        // Give each thread whole buckets, about num_bucket_points / num_threads points' worth.
+        state.thread_bucket_start[0] = 0;
+        for (size_t i = 1; i < num_threads; ++i) {
+            const uint64_t target = (static_cast<uint64_t>(num_bucket_points) * i) / num_threads;
+            const auto it = std::lower_bound(state.offsets.begin(), state.offsets.end() - 1, target);
+            state.thread_bucket_start[i] =
+                std::max(state.thread_bucket_start[i - 1], static_cast<size_t>(it - state.offsets.begin()));
+        }
+        state.thread_bucket_start[num_threads] = num_buckets;
+
+        reduce_buckets_batch_affine<Curve>(state, num_threads);
+
+        // Bucket b of an MSM holds the points with digit +-(b + 1), so its window sum is sum_b (b + 1) * bucket_b. Each
+        // thread sums its share [lo, hi) of an MSM's buckets as sum_b (b - lo + 1) * bucket_b with the usual running
+        // sum, plus lo * (its total).
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t first_bucket = state.thread_bucket_start[thread_idx];
+            const size_t end_bucket = state.thread_bucket_start[thread_idx + 1];
+            for (size_t msm = 0; msm < num_msms; ++msm) {
+                Element& thread_sum = thread_sums[thread_idx * num_msms + msm];
+                thread_sum.self_set_infinity();
+                const size_t msm_first_bucket = std::max(first_bucket, msm * num_msm_buckets);
+                const size_t msm_end_bucket = std::min(end_bucket, (msm + 1) * num_msm_buckets);
+                if (msm_first_bucket >= msm_end_bucket) {
+                    continue;
+                }
+                Element running_sum;
+                running_sum.self_set_infinity();
+                for (size_t bucket = msm_end_bucket; bucket-- > msm_first_bucket;) {
+                    if (state.sizes[bucket] != 0) {
+                        running_sum += state.points[state.offsets[bucket]];
+                    }
+                    thread_sum += running_sum;
+                }
+                thread_sum += mul_by_small_scalar(running_sum, msm_first_bucket - msm * num_msm_buckets);
+            }
+        });
+
+        for (size_t msm = 0; msm < num_msms; ++msm) {
+            for (size_t i = 0; i < num_threads; ++i) {
+                results[msm] += thread_sums[i * num_msms + msm];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Split a batch into groups of at most MAX_BATCH_POINTS points (each MSM needs its own bucket space) and run
+ * `accumulate` on each group.
+ */
+template <typename Curve, typename Accumulate>
+std::vector<typename Curve::Element> accumulate_in_groups(std::span<const SignedDigitMsmInput> msms,
+                                                          const Accumulate& accumulate)
+{
+    const size_t num_msms = msms.size();
+    std::vector<typename Curve::Element> results(num_msms);
+    for (auto& result : results) {
+        result.self_set_infinity();
+    }
+    size_t group_start = 0;
+    size_t group_num_points = 0;
+    for (size_t msm = 0; msm <= num_msms; ++msm) {
+        if (msm == num_msms || (group_num_points + msms[msm].num_points > MAX_BATCH_POINTS && msm > group_start)) {
+            std::vector<typename Curve::Element> group_results(results.begin() + static_cast<long>(group_start),
+                                                               results.begin() + static_cast<long>(msm));
+            accumulate(msms.subspan(group_start, msm - group_start), group_results);
+            std::copy(group_results.begin(), group_results.end(), results.begin() + static_cast<long>(group_start));
+            group_start = msm;
+            group_num_points = 0;
+        }
+        if (msm < num_msms) {
+            ASSERT(msms[msm].scalar_bits <= 128);
+            group_num_points += msms[msm].num_points;
+        }
+    }
+    return results;
+}
+
+/**
+ * @brief Compact each MSM's scalars and hand the resulting short and endomorphism-split MSMs to `accumulate` together.
+ *
+ * @details Every MSM becomes two: the small scalars against P_i, and the endomorphism halves of the large scalars
+ * against P_i and \lambda P_i. All of them go through the bucket passes together.
+ */
+template <typename Curve, typename Accumulate>
+std::vector<typename Curve::Element> compact_and_accumulate(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars, const Accumulate& accumulate)
+{
+    using Fr = typename Curve::ScalarField;
+
+    const size_t num_msms = scalars.size();
+    std::vector<CompactedScalars> compacted(num_msms);
+    for (size_t msm = 0; msm < num_msms; ++msm) {
+        compacted[msm] = compact_scalars<Fr>(scalars[msm]);
+    }
+
+    std::vector<SignedDigitMsmInput> inputs;
+    inputs.reserve(2 * num_msms);
+    for (const auto& msm : compacted) {
+        inputs.push_back(
+            { msm.small_indices.data(), msm.small_limbs.data(), msm.small_indices.size(), msm.small_bits });
+        inputs.push_back({ msm.big_indices.empty() ? nullptr : msm.big_indices.data(),
+                           msm.big_limbs.data(),
+                           msm.big_limbs.size() / 2,
+                           128 });
+    }
+    const std::vector<typename Curve::Element> partial_results = accumulate(inputs);
+
+    std::vector<typename Curve::Element> results(num_msms);
+    for (size_t msm = 0; msm < num_msms; ++msm) {
+        results[msm] = partial_results[2 * msm] + partial_results[2 * msm + 1];
+    }
+    return results;
+}
+
+} // namespace
+
+template <typename Curve>
+std::vector<typename Curve::Element> batch_signed_digit_msm(const typename Curve::AffineElement* points,
+                                                            std::span<const SignedDigitMsmInput> msms)
+{
+    return accumulate_in_groups<Curve>(msms, [&](auto group, auto& results) {
+        size_t total_num_points = 0;
+        size_t max_num_points = 0;
+        size_t scalar_bits = 1;
+        for (const auto& msm : group) {
+            total_num_points += msm.num_points;
+            max_num_points = std::max(max_num_points, msm.num_points);
+            scalar_bits = std::max(scalar_bits, msm.scalar_bits);
+        }
+        const size_t num_threads = std::max(std::min(get_num_cpus(), max_num_points), size_t(1));
+        const size_t window_bits =
+            get_signed_digit_window_bits(total_num_points, scalar_bits, num_threads, group.size());
+        accumulate_signed_digit_windows<Curve>(points, group, window_bits, 0, results);
+    });
+}
+
+template <typename Curve>
+std::vector<typename Curve::Element> fixed_base_signed_digit_msm(const typename Curve::AffineElement* table,
+                                                                 const size_t table_stride,
+                                                                 const size_t window_bits,
+                                                                 std::span<const SignedDigitMsmInput> msms)
+{
+    ASSERT(table_stride != 0);
+    return accumulate_in_groups<Curve>(msms, [&](auto group, auto& results) {
+        accumulate_signed_digit_windows<Curve>(table, group, window_bits, table_stride, results);
+    });
+}
+
+template <typename Curve>
+typename Curve::Element signed_digit_msm(const typename Curve::AffineElement* points,
+                                         const uint32_t* point_indices,
+                                         const uint64_t* scalar_limbs,
+                                         const size_t num_points,
+                                         const size_t scalar_bits)
+{
+    const std::array<SignedDigitMsmInput, 1> msm{ { { point_indices, scalar_limbs, num_points, scalar_bits } } };
+    return batch_signed_digit_msm<Curve>(points, msm)[0];
+}
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_signed_digit_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars, const typename Curve::AffineElement* points)
+{
+    return compact_and_accumulate<Curve>(scalars, [&](std::span<const SignedDigitMsmInput> msms) {
+        return batch_signed_digit_msm<Curve>(points, msms);
+    });
+}
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_signed_digit_fixed_base_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars,
+    const typename Curve::AffineElement* table,
+    const size_t table_stride,
+    const size_t window_bits)
+{
+    return compact_and_accumulate<Curve>(scalars, [&](std::span<const SignedDigitMsmInput> msms) {
+        return fixed_base_signed_digit_msm<Curve>(table, table_stride, window_bits, msms);
+    });
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_signed_digit_unsafe(const typename Curve::ScalarField* scalars,
+                                                      const typename Curve::AffineElement* points,
+                                                      const size_t num_initial_points)
+{
+    const std::array<std::span<const typename Curve::ScalarField>, 1> batch{ std::span(scalars, num_initial_points) };
+    return pippenger_signed_digit_batch_unsafe<Curve>(batch, points)[0];
+}
+
+template curve::BN254::Element pippenger_signed_digit_unsafe<curve::BN254>(const curve::BN254::ScalarField* scalars,
+                                                                           const curve::BN254::AffineElement* points,
+                                                                           size_t num_initial_points);
+template curve::BN254::Element signed_digit_msm<curve::BN254>(const curve::BN254::AffineElement* points,
+                                                              const uint32_t* point_indices,
+                                                              const uint64_t* scalar_limbs,
+                                                              size_t num_points,
+                                                              size_t scalar_bits);
+template std::vector<curve::BN254::Element> pippenger_signed_digit_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars, const curve::BN254::AffineElement* points);
+template std::vector<curve::BN254::Element> batch_signed_digit_msm<curve::BN254>(
+    const curve::BN254::AffineElement* points, std::span<const SignedDigitMsmInput> msms);
+template std::vector<curve::BN254::Element> fixed_base_signed_digit_msm<curve::BN254>(
+    const curve::BN254::AffineElement* table,
+    size_t table_stride,
+    size_t window_bits,
+    std::span<const SignedDigitMsmInput> msms);
+template std::vector<curve::BN254::Element> pippenger_signed_digit_fixed_base_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars,
+    const curve::BN254::AffineElement* table,
+    size_t table_stride,
+    size_t window_bits);
+
+template curve::Grumpkin::Element pippenger_signed_digit_unsafe<curve::Grumpkin>(
+    const curve::Grumpkin::ScalarField* scalars,
+    const curve::Grumpkin::AffineElement* points,
+    size_t num_initial_points);
+template curve::Grumpkin::Element signed_digit_msm<curve::Grumpkin>(const curve::Grumpkin::AffineElement* points,
+                                                                    const uint32_t* point_indices,
+                                                                    const uint64_t* scalar_limbs,
+                                                                    size_t num_points,
+                                                                    size_t scalar_bits);
+template std::vector<curve::Grumpkin::Element> pippenger_signed_digit_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    const curve::Grumpkin::AffineElement* points);
+template std::vector<curve::Grumpkin::Element> batch_signed_digit_msm<curve::Grumpkin>(
+    const curve::Grumpkin::AffineElement* points, std::span<const SignedDigitMsmInput> msms);
+template std::vector<curve::Grumpkin::Element> fixed_base_signed_digit_msm<curve::Grumpkin>(
+    const curve::Grumpkin::AffineElement* table,
+    size_t table_stride,
+    size_t window_bits,
+    std::span<const SignedDigitMsmInput> msms);
+template std::vector<curve::Grumpkin::Element> pippenger_signed_digit_fixed_base_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    const curve::Grumpkin::AffineElement* table,
+    size_t table_stride,
+    size_t window_bits);
+
+} // namespace barretenberg::scalar_multiplication
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace barretenberg::scalar_multiplication {
+
+/**
+ * Selects the multi-scalar-multiplication engine used by a commitment.
+ * PIPPENGER is the WNAF + radix sort implementation in scalar_multiplication.cpp.
+ * SIGNED_DIGIT is the bucket-parallel, batch-affine implementation in signed_digit_msm.cpp.
+ */
+enum class MsmAlgorithm { PIPPENGER, SIGNED_DIGIT };
+
+/**
+ * A second Pippenger engine. Differences to `pippenger`:
+ *
+ * 1. Scalars are recoded into signed digits with Booth recoding. Digit j of k is read straight off bits
+ *    [jc - 1, jc + c - 1] of k, so digits can be computed for any window independently (no carry chain, no wnaf table
+ *    to store), lie in [-2^{c-1}, 2^{c-1}] (2^{c-1} buckets for a c-bit window) and zero digits are skipped instead of
+ *    being forced odd and corrected with a skew.
+ *
+ * 2. The window width is picked at runtime from a cost model that accounts for the number of points, the number of
+ *    buckets and the number of threads (see `get_signed_digit_window_bits`), rather than a static table.
+ *
+ * 3. Each window is bucket-sorted with a counting sort and every thread owns a contiguous range of *whole* buckets,
+ *    balanced by point count. No bucket is split between threads, so there is no overlap to patch up afterwards.
+ *    Bucket contents are then added pairwise in affine form, level by level. All of the additions in a level, across
+ *    all threads, share a single field inversion: each thread multiplies up its denominators, one thread inverts the
+ *    product of the per-thread products, and the threads then back-substitute their own share.
+ *
+ * 4. Sparse and small scalars are cheap. Zero scalars are compacted out before any window is processed, and scalars
+ *    below 2^64 skip the endomorphism split and go through a short MSM over only as many windows as their bit length
+ *    needs, sharing the bucket passes with the full-width scalars. Selector-like columns, read counts, ECC op wires and
+ *    databus columns cost roughly in proportion to their number of non-zero entries and their width.
+ *
+ * Points are expected in the `generate_pippenger_point_table` layout ([P_0, \lambda P_0, P_1, \lambda P_1, ...]).
+ * Like `pippenger_unsafe`, the incomplete affine addition formula is used, so the points must be linearly independent
+ * (e.g. an SRS). Don't use this in a verifier.
+ */
+template <typename Curve>
+typename Curve::Element pippenger_signed_digit_unsafe(const typename Curve::ScalarField* scalars,
+                                                      const typename Curve::AffineElement* points,
+                                                      size_t num_initial_points);
+
+/**
+ * @brief Compute several MSMs over the same base points in one pass.
+ *
+ * @details MSM j is sum_i scalars[j][i] * P_i. The MSMs share the bucket sort and the batched inversions, and each
+ * base point is loaded once per window however many MSMs use it. The MSMs may have different lengths.
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_signed_digit_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars, const typename Curve::AffineElement* points);
+
+/**
+ * @brief Core of the signed-digit engine, exposed for callers that do their own scalar decomposition.
+ *
+ * @param points Base points
+ * @param point_indices If non-null, scalar i multiplies points[point_indices[i]], otherwise points[i]
+ * @param scalar_limbs Two little-endian 64-bit limbs per scalar
+ * @param num_points Number of scalars
+ * @param scalar_bits Upper bound on the bit length of every scalar, at most 128
+ */
+template <typename Curve>
+typename Curve::Element signed_digit_msm(const typename Curve::AffineElement* points,
+                                         const uint32_t* point_indices,
+                                         const uint64_t* scalar_limbs,
+                                         size_t num_points,
+                                         size_t scalar_bits);
+
+/**
+ * One MSM of a batch, see signed_digit_msm for the meaning of the fields.
+ */
+struct SignedDigitMsmInput {
+    const uint32_t* point_indices;
+    const uint64_t* scalar_limbs;
+    size_t num_points;
+    size_t scalar_bits;
+};
+
+/**
+ * @brief Batched form of signed_digit_msm. The MSMs share the window width, the bucket sort and the batched
+ * inversions; MSMs with shorter scalars skip the windows above their scalar_bits.
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> batch_signed_digit_msm(const typename Curve::AffineElement* points,
+                                                            std::span<const SignedDigitMsmInput> msms);
+
+/**
+ * @brief Signed-digit MSMs against a fixed-base table, with no doublings.
+ *
+ * @details Window j of the table, at table + j * table_stride, holds 2^{j * window_bits} times the base points, so
+ * digit j of a scalar can go straight into the buckets as a digit of the j-th multiple of its point. All windows share
+ * one set of buckets and the windows are never combined with doublings. The table must cover every window of the
+ * longest scalar, i.e. (scalar_bits + window_bits) / window_bits windows.
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> fixed_base_signed_digit_msm(const typename Curve::AffineElement* table,
+                                                                 size_t table_stride,
+                                                                 size_t window_bits,
+                                                                 std::span<const SignedDigitMsmInput> msms);
+
+/**
+ * @brief pippenger_signed_digit_batch_unsafe against a fixed-base table (see fixed_base_signed_digit_msm) whose
+ * window 0 is a pippenger point table, i.e. table_stride is twice the number of SRS points.
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_signed_digit_fixed_base_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars,
+    const typename Curve::AffineElement* table,
+    size_t table_stride,
+    size_t window_bits);
+
+/**
+ * @brief Window width (in bits) minimising the estimated cost of a signed-digit MSM.
+ *
+ * @param num_points Number of (post-endomorphism) points, summed over all MSMs
+ * @param scalar_bits Bit length of the scalars
+ * @param num_threads Number of threads the MSM will run on
+ * @param num_msms Number of MSMs computed together
+ */
+size_t get_signed_digit_window_bits(size_t num_points, size_t scalar_bits, size_t num_threads, size_t num_msms = 1);
+
+/**
+ * @brief Window width (in bits) minimising the cost of fixed_base_signed_digit_msm with a table of at most
+ * max_table_points points, or 0 if no window width fits.
+ *
+ * @param num_points Number of base points (the table stride)
+ * @param scalar_bits Bit length of the scalars
+ * @param max_table_points Maximum number of points in the table, summed over all windows
+ */
+size_t get_fixed_base_window_bits(size_t num_points, size_t scalar_bits, size_t max_table_points);
+
+extern template curve::BN254::Element pippenger_signed_digit_unsafe<curve::BN254>(
+    const curve::BN254::ScalarField* scalars, const curve::BN254::AffineElement* points, size_t num_initial_points);
+extern template curve::BN254::Element signed_digit_msm<curve::BN254>(const curve::BN254::AffineElement* points,
+                                                                     const uint32_t* point_indices,
+                                                                     const uint64_t* scalar_limbs,
+                                                                     size_t num_points,
+                                                                     size_t scalar_bits);
+extern template std::vector<curve::BN254::Element> pippenger_signed_digit_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars, const curve::BN254::AffineElement* points);
+extern template std::vector<curve::BN254::Element> batch_signed_digit_msm<curve::BN254>(
+    const curve::BN254::AffineElement* points, std::span<const SignedDigitMsmInput> msms);
+extern template std::vector<curve::BN254::Element> fixed_base_signed_digit_msm<curve::BN254>(
+    const curve::BN254::AffineElement* table,
+    size_t table_stride,
+    size_t window_bits,
+    std::span<const SignedDigitMsmInput> msms);
+extern template std::vector<curve::BN254::Element> pippenger_signed_digit_fixed_base_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars,
+    const curve::BN254::AffineElement* table,
+    size_t table_stride,
+    size_t window_bits);
+
+extern template curve::Grumpkin::Element pippenger_signed_digit_unsafe<curve::Grumpkin>(
+    const curve::Grumpkin::ScalarField* scalars,
+    const curve::Grumpkin::AffineElement* points,
+    size_t num_initial_points);
+extern template curve::Grumpkin::Element signed_digit_msm<curve::Grumpkin>(
+    const curve::Grumpkin::AffineElement* points,
+    const uint32_t* point_indices,
+    const uint64_t* scalar_limbs,
+    size_t num_points,
+    size_t scalar_bits);
+extern template std::vector<curve::Grumpkin::Element> pippenger_signed_digit_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    const curve::Grumpkin::AffineElement* points);
+extern template std::vector<curve::Grumpkin::Element> batch_signed_digit_msm<curve::Grumpkin>(
+    const curve::Grumpkin::AffineElement* points, std::span<const SignedDigitMsmInput> msms);
+extern template std::vector<curve::Grumpkin::Element> fixed_base_signed_digit_msm<curve::Grumpkin>(
+    const curve::Grumpkin::AffineElement* table,
+    size_t table_stride,
+    size_t window_bits,
+    std::span<const SignedDigitMsmInput> msms);
+extern template std::vector<curve::Grumpkin::Element> pippenger_signed_digit_fixed_base_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    const curve::Grumpkin::AffineElement* table,
+    size_t table_stride,
+    size_t window_bits);
+
+} // namespace barretenberg::scalar_multiplication
@@ -0,0 +1,76 @@
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/proof_system/plookup_tables/fixed_base/fixed_base.hpp"
+
+using plookup::fixed_base::table;
+
+void write_point(std::ostream& os, const table::affine_element& point)
+{
+    // The limbs are written in Montgomery form, so that proof_system can use the points where they are
+    os << "    { grumpkin::fq(";
+    for (size_t i = 0; i < 4; ++i) {
+        os << "0x" << std::setw(16) << point.x.data[i] << (i < 3 ? ", " : "), grumpkin::fq(");
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        os << "0x" << std::setw(16) << point.y.data[i] << (i < 3 ? ", " : ") },\n");
+    }
+}
+
+/**
+ * @brief Generates the fixed-base lookup tables and their offset generators, as a source file that proof_system
+ * embeds when built with FIXED_BASE_TABLES_BLOB.
+ *
+ * @details The points of every table are listed in order of multitable, then table, then index, followed by the
+ * offset generator of each multitable. They are preceded by the digest of these points and of the base points and
+ * parameters they were generated from (see table::compute_tables_digest), which proof_system checks against the
+ * embedded points before using them.
+ */
+int main(int argc, char** argv)
+{
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() != 2) {
+        info("usage: ", args[0], " <output_path>");
+        return 1;
+    }
+    const std::filesystem::path output_path = args[1];
+    const std::filesystem::path tmp_path = output_path.string() + ".tmp";
+
+    const auto& tables = table::fixed_base_tables();
+    const auto& offset_generators = table::fixed_base_table_offset_generators();
+    {
+        std::ofstream os(tmp_path);
+        os << std::hex << std::setfill('0');
+        os << "// Generated by fixed_base_tables_gen. Do not edit.\n";
+        os << "static constexpr uint8_t FIXED_BASE_TABLES_DIGEST[] = {";
+        for (const uint8_t byte : table::compute_tables_digest(tables, offset_generators)) {
+            os << " 0x" << std::setw(2) << static_cast<uint32_t>(byte) << ",";
+        }
+        os << " };\n";
+        os << "static constexpr grumpkin::g1::affine_element FIXED_BASE_TABLE_POINTS[] = {\n";
+        for (const auto& multi_table : tables) {
+            for (const auto& lookup_table : multi_table) {
+                for (const auto& point : lookup_table) {
+                    write_point(os, point);
+                }
+            }
+        }
+        os << "};\n";
+        os << "static constexpr std::array<grumpkin::g1::affine_element, " << std::dec
+           << table::NUM_FIXED_BASE_MULTI_TABLES << std::hex << "> FIXED_BASE_OFFSET_GENERATORS = { {\n";
+        for (const auto& point : offset_generators) {
+            write_point(os, point);
+        }
+        os << "} };\n";
+        if (!os.good()) {
+            info("failed to write ", tmp_path);
+            return 1;
+        }
+    }
+    // Only replace the output once it is complete, so an interrupted run does not leave a truncated file behind
+    std::filesystem::rename(tmp_path, output_path);
+    return 0;
+}
@@ -824,4 +824,34 @@ TEST(ultra_plonk_composer, range_constraint_small_variable)
     EXPECT_EQ(result, true);
 }
 
+// The work queue batches its scalar multiplications by default; one pippenger per item must give an equally valid
+// proof.
+TEST(ultra_plonk_composer, msm_engines)
+{
+    using barretenberg::scalar_multiplication::MsmAlgorithm;
+    // A prover consumes its proving key, so each one gets a circuit of its own
+    auto prove_and_verify = [](std::optional<MsmAlgorithm> msm_algorithm) {
+        auto builder = UltraCircuitBuilder();
+        auto composer = UltraComposer();
+        for (size_t i = 0; i < 64; ++i) {
+            uint32_t a_idx = builder.add_variable(fr::random_element());
+            uint32_t b_idx = builder.add_variable(fr::random_element());
+            uint32_t c_idx = builder.add_variable(builder.get_variable(a_idx) * builder.get_variable(b_idx));
+            builder.create_poly_gate({ a_idx, b_idx, c_idx, fr(1), fr(0), fr(0), fr(-1), fr(0) });
+        }
+        auto prover = composer.create_prover(builder);
+        if (msm_algorithm.has_value()) {
+            prover.queue.msm_algorithm = *msm_algorithm;
+        } else {
+            EXPECT_EQ(prover.queue.msm_algorithm, MsmAlgorithm::SIGNED_DIGIT);
+        }
+        auto proof = prover.construct_proof();
+        auto verifier = composer.create_verifier(builder);
+        return verifier.verify_proof(proof);
+    };
+
+    EXPECT_TRUE(prove_and_verify(std::nullopt));
+    EXPECT_TRUE(prove_and_verify(MsmAlgorithm::PIPPENGER));
+}
+
 } // namespace proof_system::plonk::test_ultra_plonk_composer
@@ -36,6 +36,7 @@ ProverBase<settings>::ProverBase(ProverBase<settings>&& other)
     , commitment_scheme(std::move(other.commitment_scheme))
     , queue(key.get(), &transcript)
 {
+    queue.msm_algorithm = other.queue.msm_algorithm;
     for (size_t i = 0; i < other.random_widgets.size(); ++i) {
         random_widgets.emplace_back(std::move(other.random_widgets[i]));
     }
@@ -61,6 +62,7 @@ template <typename settings> ProverBase<settings>& ProverBase<settings>::operato
     commitment_scheme = std::move(other.commitment_scheme);
 
     queue = work_queue(key.get(), &transcript);
+    queue.msm_algorithm = other.queue.msm_algorithm;
     return *this;
 }
 
@@ -2,6 +2,7 @@
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include <unordered_set>
 
 namespace proof_system::plonk {
 
@@ -88,4 +89,38 @@ void proving_key::init()
     memset((void*)&quotient_polynomial_parts[3][0], 0x00, sizeof(barretenberg::fr) * circuit_size);
 }
 
+#ifndef __wasm__
+std::shared_ptr<proving_key> proving_key::share_precomputed() const
+{
+    auto key = std::make_shared<proving_key>(circuit_size, num_public_inputs, reference_string, circuit_type);
+    key->contains_recursive_proof = contains_recursive_proof;
+    key->recursive_proof_public_input_indices = recursive_proof_public_input_indices;
+    key->memory_read_records = memory_read_records;
+    key->memory_write_records = memory_write_records;
+    // Selector and permutation polynomials, in every form, are fixed by the circuit and only ever read by a proof, so
+    // those are shared. Anything else already in the store (a buffer a proof fills in, or what an earlier proof left
+    // behind) is deep copied, so that no proof can write to memory another proof reads.
+    std::unordered_set<std::string_view> shared_labels;
+    for (auto const& descriptor : polynomial_manifest.get()) {
+        if (descriptor.source == PolynomialSource::SELECTOR || descriptor.source == PolynomialSource::PERMUTATION) {
+            shared_labels.insert(descriptor.polynomial_label);
+        }
+    }
+    for (auto const& [label, polynomial] : polynomial_store) {
+        std::string_view base_label = label;
+        for (std::string_view suffix : { "_lagrange", "_fft" }) {
+            if (base_label.ends_with(suffix)) {
+                base_label.remove_suffix(suffix.size());
+            }
+        }
+        if (shared_labels.contains(base_label)) {
+            key->polynomial_store.put(label, polynomial.clone());
+        } else {
+            key->polynomial_store.put(label, barretenberg::polynomial(polynomial));
+        }
+    }
+    return key;
+}
+#endif
+
 } // namespace proof_system::plonk
@@ -55,6 +55,16 @@ struct proving_key {
 
     void init();
 
+#ifndef __wasm__
+    /**
+     * @brief A key for proving the same circuit as this one, at the same time. The selector and permutation
+     * polynomials are shared with the new key rather than copied, which is safe as long as proofs only read them;
+     * every other polynomial and whatever a proof adds or replaces (witness polynomials, quotient parts, memory
+     * records) belongs to the key it runs with.
+     */
+    std::shared_ptr<proving_key> share_precomputed() const;
+#endif
+
     CircuitType circuit_type;
     size_t circuit_size;
     size_t log_circuit_size;
@@ -1,5 +1,7 @@
 #include "work_queue.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
@@ -201,21 +203,48 @@ void work_queue::add_to_queue(const work_item& item)
 
 void work_queue::process_queue()
 {
+    // The scalar multiplications are independent of the other work items, so compute them all up front. With the
+    // default SIGNED_DIGIT engine they are done as one batched MSM that reads the SRS once, rather than one pippenger
+    // per item.
+    std::vector<std::span<const barretenberg::fr>> msm_scalars;
     for (const auto& item : work_item_queue) {
-        switch (item.work_type) {
-        // most expensive op
-        case WorkType::SCALAR_MULTIPLICATION: {
+        if (item.work_type == WorkType::SCALAR_MULTIPLICATION) {
             // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
             auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
-
             ASSERT(msm_size <= key->reference_string->get_monomial_size());
+            msm_scalars.emplace_back(item.mul_scalars.get(), msm_size);
+        }
+    }
+    std::vector<barretenberg::g1::element> msm_results;
+    if (!msm_scalars.empty()) {
+        barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+        if (auto fixed_base_table = key->reference_string->get_fixed_base_table()) {
+            msm_results = fixed_base_table->batch_msm(msm_scalars);
+        } else if (use_signed_digit_msm()) {
+            msm_results = barretenberg::scalar_multiplication::pippenger_signed_digit_batch_unsafe<curve::BN254>(
+                msm_scalars, srs_points);
+        } else {
+            msm_results.reserve(msm_scalars.size());
+            for (const auto& scalars : msm_scalars) {
+                // Run pippenger multi-scalar multiplication.
+                auto runtime_state =
+                    barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>(scalars.size());
+                msm_results.emplace_back(barretenberg::scalar_multiplication::pippenger_unsafe<curve::BN254>(
+                    const_cast<barretenberg::fr*>(scalars.data()), srs_points, scalars.size(), runtime_state));
+            }
+        }
+    }
+    size_t msm_index = 0;
 
-            barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+    // IFFTs first, as an FFT can read the output of an IFFT in the same queue.
+    process_ifft_items();
+    process_fft_items();
 
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
-            barretenberg::g1::affine_element result(barretenberg::scalar_multiplication::pippenger_unsafe<curve::BN254>(
-                item.mul_scalars.get(), srs_points, msm_size, runtime_state));
+    for (const auto& item : work_item_queue) {
+        switch (item.work_type) {
+        // most expensive op
+        case WorkType::SCALAR_MULTIPLICATION: {
+            barretenberg::g1::affine_element result(msm_results[msm_index++]);
 
             transcript->add_element(item.tag, result.to_buffer());
 
@@ -248,38 +277,92 @@ void work_queue::process_queue()
         //     }
         //     break;
         // }
-        case WorkType::FFT: {
-            using namespace barretenberg;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
+        // The FFTs and IFFTs have been done above, in batches.
+        default: {
+        }
+        }
+    }
+    work_item_queue = std::vector<work_item>();
+}
 
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
+/**
+ * @brief The queued items of the given type, in groups of at most MAX_TRANSFORM_BATCH_SIZE.
+ */
+std::vector<std::vector<const work_queue::work_item*>> work_queue::get_transform_batches(const WorkType work_type) const
+{
+    std::vector<std::vector<const work_item*>> batches;
+    for (const auto& item : work_item_queue) {
+        if (item.work_type == work_type) {
+            if (batches.empty() || batches.back().size() == MAX_TRANSFORM_BATCH_SIZE) {
+                batches.emplace_back();
             }
-
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-
-            break;
+            batches.back().push_back(&item);
         }
-        // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
-        case WorkType::IFFT: {
-            using namespace barretenberg;
-            // retrieve wire in lagrange form
-            auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
+    }
+    return batches;
+}
 
-            // Compute wire monomial form via ifft on lagrange form then add it to the store
-            polynomial wire_monomial(key->circuit_size);
-            polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
-            key->polynomial_store.put(item.tag, std::move(wire_monomial));
+/**
+ * @brief Compute the monomial forms of the IFFT items' wires from their lagrange forms, a batch at a time.
+ *
+ * @details 1/4 the cost of an fft (each fft has 1/4 the number of elements).
+ */
+void work_queue::process_ifft_items()
+{
+    for (const auto& batch : get_transform_batches(WorkType::IFFT)) {
+        std::vector<polynomial> lagrange_forms;
+        std::vector<polynomial> monomial_forms;
+        std::vector<const fr*> coeffs;
+        std::vector<fr*> targets;
+        for (const auto* item : batch) {
+            lagrange_forms.push_back(key->polynomial_store.get(item->tag + "_lagrange"));
+            monomial_forms.emplace_back(key->circuit_size);
+            coeffs.push_back(&lagrange_forms.back()[0]);
+            targets.push_back(&monomial_forms.back()[0]);
+        }
+        polynomial_arithmetic::ifft_batch(coeffs, targets, key->circuit_size, key->small_domain);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            key->polynomial_store.put(batch[i]->tag, std::move(monomial_forms[i]));
+        }
+    }
+}
 
-            break;
+/**
+ * @brief Compute the 4n coset evaluations of the FFT items' polynomials, a batch at a time.
+ *
+ * @details The monomial forms are read where they are (past their end counts as zero) rather than copied into
+ * zero-padded 4n buffers first. Each result has 4 more entries, which wrap around to its first 4 evaluations.
+ */
+void work_queue::process_fft_items()
+{
+    const size_t large_size = key->large_domain.size;
+    for (const auto& batch : get_transform_batches(WorkType::FFT)) {
+        std::vector<polynomial> monomial_forms;
+        std::vector<polynomial> coset_forms;
+        size_t num_coeffs = 0;
+        for (const auto* item : batch) {
+            monomial_forms.push_back(key->polynomial_store.get(item->tag));
+            coset_forms.emplace_back(large_size + 4);
+            num_coeffs = std::max(num_coeffs, std::min(monomial_forms.back().size(), large_size));
         }
-        default: {
+        std::vector<const fr*> coeffs;
+        std::vector<fr*> targets;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            // The batch reads the same number of coefficients from each polynomial. They are all n long in practice.
+            if (monomial_forms[i].size() < num_coeffs) {
+                monomial_forms[i] = polynomial(monomial_forms[i], num_coeffs);
+            }
+            coeffs.push_back(&monomial_forms[i][0]);
+            targets.push_back(&coset_forms[i][0]);
         }
+        polynomial_arithmetic::coset_fft_batch(coeffs, targets, num_coeffs, key->large_domain);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            for (size_t j = 0; j < 4; j++) {
+                coset_forms[i][large_size + j] = coset_forms[i][j];
+            }
+            key->polynomial_store.put(batch[i]->tag + "_fft", std::move(coset_forms[i]));
         }
     }
-    work_item_queue = std::vector<work_item>();
 }
 
 std::vector<work_queue::work_item> work_queue::get_queue() const
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/plonk/transcript/transcript_wrappers.hpp"
 
@@ -63,7 +64,36 @@ class work_queue {
 
     std::vector<work_item> get_queue() const;
 
+    /**
+     * The engine used for SCALAR_MULTIPLICATION items when the SRS has no fixed-base table. SIGNED_DIGIT, the default,
+     * batches all items into one `pippenger_signed_digit_batch_unsafe` that reads the SRS once, as Honk's
+     * CommitmentKey::batch_commit does; the batch is split into groups of at most MAX_BATCH_POINTS points, so its
+     * buckets stay under 256MB. PIPPENGER runs one `pippenger_unsafe` per item, and is always used in WASM.
+     */
+    barretenberg::scalar_multiplication::MsmAlgorithm msm_algorithm =
+        barretenberg::scalar_multiplication::MsmAlgorithm::SIGNED_DIGIT;
+
   private:
+    // Transforms of the same type are done together, see polynomial_arithmetic::fft_batch. The wasm prover keeps
+    // polynomials in a size-limited cache, so it does them one at a time rather than hold a batch of them.
+#ifdef __wasm__
+    static constexpr size_t MAX_TRANSFORM_BATCH_SIZE = 1;
+#else
+    static constexpr size_t MAX_TRANSFORM_BATCH_SIZE = 64;
+#endif
+
+    bool use_signed_digit_msm() const
+    {
+#ifdef __wasm__
+        return false;
+#else
+        return msm_algorithm == barretenberg::scalar_multiplication::MsmAlgorithm::SIGNED_DIGIT;
+#endif
+    }
+    std::vector<std::vector<const work_item*>> get_transform_batches(WorkType work_type) const;
+    void process_ifft_items();
+    void process_fft_items();
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
@@ -87,4 +87,18 @@ TYPED_TEST(BarycentricDataTests, BarycentricData5to6)
     EXPECT_EQ(ext1, expected);
 }
 
+TYPED_TEST(BarycentricDataTests, BarycentricData5to12)
+{
+    BARYCENTIC_DATA_TESTS_TYPE_ALIASES
+
+    const size_t domain_size = 5;
+    const size_t num_evals = 12;
+
+    // Enough new points for the vectorized extension, where the CPU has it.
+    Univariate<FF, domain_size> e1{ { 1, 3, 25, 109, 321 } }; // X^4 + X^3 + 1
+    Univariate<FF, num_evals> ext1 = e1.template extend_to<num_evals>();
+    Univariate<FF, num_evals> expected{ { 1, 3, 25, 109, 321, 751, 1513, 2745, 4609, 7291, 11001, 15973 } };
+    EXPECT_EQ(ext1, expected);
+}
+
 } // namespace barretenberg::test_barycentric
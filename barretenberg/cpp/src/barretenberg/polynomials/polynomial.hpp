@@ -53,7 +53,7 @@ template <typename Fr> class Polynomial {
     /**
      * Return a shallow clone of the polynomial. i.e. underlying memory is shared.
      */
-    Polynomial clone()
+    Polynomial clone() const
     {
         Polynomial p;
         p.coefficients_ = coefficients_;
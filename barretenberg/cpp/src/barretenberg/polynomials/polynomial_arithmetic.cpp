@@ -8,6 +8,9 @@
 #include <math.h>
 #include <memory.h>
 #include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
 
 namespace barretenberg::polynomial_arithmetic {
 
@@ -16,17 +19,39 @@ namespace {
 template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_elements)
 {
     // WASM needs to release slab so it can be reused elsewhere.
-    // But for native code it's more performant to hold onto it.
+    // But for native code it's more performant to hold onto it. The buffers are pooled rather than shared, as FFTs can
+    // run concurrently: several proofs at once, or a thread waiting in parallel_for picking up another FFT.
 #ifdef __wasm__
     return std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
 #else
-    static std::shared_ptr<Fr[]> working_memory = nullptr;
-    static size_t current_size = 0;
-    if (num_elements > current_size) {
-        working_memory = std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
-        current_size = num_elements;
+    static std::mutex pool_mutex;
+    static std::vector<std::pair<size_t, std::shared_ptr<Fr[]>>> pool;
+    std::shared_ptr<Fr[]> buffer;
+    size_t buffer_size = num_elements;
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        auto best = pool.end();
+        for (auto it = pool.begin(); it != pool.end(); ++it) {
+            if (it->first >= num_elements && (best == pool.end() || it->first < best->first)) {
+                best = it;
+            }
+        }
+        if (best != pool.end()) {
+            buffer_size = best->first;
+            buffer = std::move(best->second);
+            pool.erase(best);
+        } else {
+            // Growing: drop the buffers that are now too small, as a single growing buffer would.
+            std::erase_if(pool, [&](auto const& entry) { return entry.first < num_elements; });
+        }
     }
-    return working_memory;
+    if (!buffer) {
+        buffer = std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
+    }
+    return std::shared_ptr<Fr[]>(buffer.get(), [buffer, buffer_size](Fr*) {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        pool.emplace_back(buffer_size, buffer);
+    });
 #endif
 }
 
@@ -296,101 +321,243 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
     }
 }
 
+namespace {
+
+// log2 of the elements an FFT pass works on at once: 2^12 field elements are 128KB, which stays in L2.
+constexpr size_t FFT_TILE_LOG2 = 12;
+// log2 of the adjacent elements of each row a later pass loads together, a few cache lines' worth.
+constexpr size_t FFT_COLUMN_LOG2 = 4;
+// The first pass uses smaller tiles, down to this size, to give every thread a tile of a small domain.
+constexpr size_t FFT_MIN_TILE_LOG2 = 6;
+
+inline size_t reverse_low_bits(size_t x, size_t bit_length)
+{
+    return bit_length == 0 ? 0 : reverse_bits(static_cast<uint32_t>(x), static_cast<uint32_t>(bit_length));
+}
+
+// Coefficient i < size is multiplied by start * generator^i on its way into the transform.
+template <typename Fr> struct CosetScaling {
+    Fr start;
+    Fr generator;
+    size_t size;
+};
+
+/**
+ * @brief Radix-2 FFTs of the polynomials `coeffs` into `targets`, in passes over cache-sized blocks.
+ *
+ * @details The butterfly rounds are grouped so that each pass over the array does as many rounds as fit in one
+ * cache-sized block, rather than one round per pass:
+ *
+ * - The first pass splits the output into tiles of 2^FFT_TILE_LOG2 elements. The bit-reversal permutation puts the
+ *   inputs of the first FFT_TILE_LOG2 rounds of a tile in that tile, so each tile gathers its (bit-reversed)
+ *   coefficients, applies the coset scaling as it reads them, and runs those rounds without leaving cache.
+ * - Each later pass does the next rounds, up to FFT_TILE_LOG2 - FFT_COLUMN_LOG2 of them. The inputs of those rounds
+ *   are rows at a stride of 2^(rounds done so far); a block of 2^FFT_COLUMN_LOG2 adjacent columns of all its rows is
+ *   copied into a contiguous buffer (a power-of-two stride would map every row to the same cache sets), transformed
+ *   there and written back, scaled by output_scale if it is the last pass.
+ *
+ * A 2^20 transform is then 2 passes over memory rather than 21, and 2^24 is 3 rather than 25.
+ *
+ * All the polynomials go through each pass together: a task takes a tile or block and transforms it in every
+ * polynomial in turn, so the twiddles and coset powers of the tile or block are read into cache once per batch, and
+ * the batch waits on one set of threads per pass rather than one per polynomial.
+ *
+ * Only the first num_coeffs coefficients of each polynomial are read, the rest are taken to be zero. A target may be
+ * its own input, which then costs a scratch buffer.
+ */
 template <typename Fr>
     requires SupportsFFT<Fr>
-void fft_inner_parallel(
-    Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
+void fft_blocked_batch(std::span<const Fr* const> coeffs,
+                       std::span<Fr* const> targets,
+                       const size_t num_coeffs,
+                       const EvaluationDomain<Fr>& domain,
+                       const std::vector<Fr*>& root_table,
+                       const CosetScaling<Fr>* scaling = nullptr,
+                       const Fr* output_scale = nullptr)
 {
-    parallel_for(domain.num_threads, [&](size_t j) {
-        Fr temp_1;
-        Fr temp_2;
-        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-            __builtin_prefetch(&coeffs[next_index_1]);
-            __builtin_prefetch(&coeffs[next_index_2]);
+    const size_t num_polys = coeffs.size();
+    ASSERT(targets.size() == num_polys);
+    ASSERT(num_coeffs <= domain.size);
+    if (num_polys == 0) {
+        return;
+    }
+    const size_t log2_size = domain.log2_size;
+    const size_t num_cpus = get_num_cpus();
+
+    // The first pass reads coefficients from all over the input, so it can't write over it.
+    std::vector<std::shared_ptr<Fr[]>> scratch_spaces;
+    std::vector<Fr*> work(targets.begin(), targets.end());
+    for (size_t p = 0; p < num_polys; ++p) {
+        if (coeffs[p] == targets[p]) {
+            scratch_spaces.push_back(get_scratch_space<Fr>(domain.size));
+            work[p] = scratch_spaces.back().get();
+        }
+    }
 
-            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
+    size_t tile_log2 = std::min(FFT_TILE_LOG2, log2_size);
+    while (tile_log2 > FFT_MIN_TILE_LOG2 && (num_polys << (log2_size - tile_log2)) < num_cpus) {
+        --tile_log2;
+    }
+    const size_t tile_size = 1UL << tile_log2;
+    const size_t log2_num_tiles = log2_size - tile_log2;
+    const size_t num_tiles = 1UL << log2_num_tiles;
+    const bool single_pass = log2_num_tiles == 0;
+
+    // Tile t reads coefficient (rev(u) << log2_num_tiles) + rev(t) into its slot u, whose scaling factor is
+    // (generator^num_tiles)^rev(u) * generator^rev(t): a table shared by all tiles, times a factor per tile.
+    std::vector<Fr> tile_powers;
+    if (scaling != nullptr) {
+        tile_powers.resize(tile_size);
+        const Fr step = scaling->generator.pow(static_cast<uint64_t>(num_tiles));
+        tile_powers[0] = Fr::one();
+        for (size_t i = 1; i < tile_size; ++i) {
+            tile_powers[i] = tile_powers[i - 1] * step;
+        }
+    }
 
-            Fr::__copy(coeffs[swap_index_1], temp_1);
-            Fr::__copy(coeffs[swap_index_2], temp_2);
-            target[i + 1] = temp_1 - temp_2;
-            target[i] = temp_1 + temp_2;
+    // Work unit u is tile u / num_polys of polynomial u % num_polys.
+    const size_t num_tile_units = num_tiles * num_polys;
+    const size_t num_tile_tasks = std::min(num_tile_units, num_cpus);
+    parallel_for(num_tile_tasks, [&](size_t task) {
+        const size_t unit_start = task * num_tile_units / num_tile_tasks;
+        const size_t unit_end = (task + 1) * num_tile_units / num_tile_tasks;
+        size_t tile_factor_tile = num_tiles;
+        Fr tile_factor = Fr::one();
+        for (size_t unit = unit_start; unit < unit_end; ++unit) {
+            const size_t tile = unit / num_polys;
+            const size_t p = unit % num_polys;
+            const Fr* in = coeffs[p];
+            Fr* out = work[p] + (tile << tile_log2);
+            const size_t tile_offset = reverse_low_bits(tile, log2_num_tiles);
+
+            if (scaling != nullptr && tile != tile_factor_tile) {
+                tile_factor = scaling->start * scaling->generator.pow(static_cast<uint64_t>(tile_offset));
+                tile_factor_tile = tile;
+            }
+            auto read = [&](size_t slot) {
+                const size_t reversed_slot = reverse_low_bits(slot, tile_log2);
+                const size_t index = (reversed_slot << log2_num_tiles) + tile_offset;
+                if (index >= num_coeffs) {
+                    return Fr::zero();
+                }
+                Fr value = in[index];
+                if (scaling != nullptr && index < scaling->size) {
+                    value *= tile_powers[reversed_slot] * tile_factor;
+                }
+                return value;
+            };
+            // The first round (all twiddles 1) as the tile is gathered.
+            if (tile_size == 1) {
+                out[0] = read(0);
+            }
+            for (size_t i = 0; i + 1 < tile_size; i += 2) {
+                Fr a = read(i);
+                Fr b = read(i + 1);
+                out[i] = a + b;
+                out[i + 1] = a - b;
+            }
+            for (size_t round = 1; round < tile_log2; ++round) {
+                const size_t m = 1UL << round;
+                const Fr* round_roots = root_table[round - 1];
+                for (size_t k = 0; k < tile_size; k += 2 * m) {
+                    for (size_t j = 0; j < m; ++j) {
+                        Fr temp = round_roots[j] * out[k + j + m];
+                        out[k + j + m] = out[k + j] - temp;
+                        out[k + j] += temp;
+                    }
+                }
+            }
+            if (single_pass && output_scale != nullptr) {
+                for (size_t i = 0; i < tile_size; ++i) {
+                    out[i] *= *output_scale;
+                }
+            }
         }
     });
 
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-    // reduce + copy
-    if (domain.size <= 2) {
-        coeffs[0] = target[0];
-        coeffs[1] = target[1];
+    // The remaining rounds, FFT_TILE_LOG2 - FFT_COLUMN_LOG2 at a time.
+    for (size_t first_round = tile_log2; first_round < log2_size;) {
+        const size_t num_rounds = std::min(FFT_TILE_LOG2 - FFT_COLUMN_LOG2, log2_size - first_round);
+        const size_t column_log2 = std::min(FFT_COLUMN_LOG2, first_round);
+        const size_t num_rows = 1UL << num_rounds;
+        const size_t num_columns = 1UL << column_log2;
+        const size_t blocks_per_row_log2 = first_round - column_log2;
+        const size_t num_blocks = domain.size >> (num_rounds + column_log2);
+        const bool last_pass = first_round + num_rounds == log2_size;
+
+        // Work unit u is block u / num_polys of polynomial u % num_polys.
+        const size_t num_block_units = num_blocks * num_polys;
+        const size_t num_block_tasks = std::min(num_block_units, num_cpus);
+        parallel_for(num_block_tasks, [&](size_t task) {
+            std::vector<Fr> block(num_rows * num_columns);
+            const size_t unit_start = task * num_block_units / num_block_tasks;
+            const size_t unit_end = (task + 1) * num_block_units / num_block_tasks;
+            for (size_t unit = unit_start; unit < unit_end; ++unit) {
+                const size_t b = unit / num_polys;
+                const size_t p = unit % num_polys;
+                const Fr* in = work[p];
+                Fr* out = last_pass ? targets[p] : work[p];
+                const size_t column_start = (b & ((1UL << blocks_per_row_log2) - 1)) << column_log2;
+                const size_t base = ((b >> blocks_per_row_log2) << (first_round + num_rounds)) + column_start;
+                for (size_t row = 0; row < num_rows; ++row) {
+                    const Fr* src = in + base + (row << first_round);
+                    std::copy(src, src + num_columns, &block[row << column_log2]);
+                }
+                for (size_t round = 0; round < num_rounds; ++round) {
+                    // Rows `half` apart are `m` apart in the array, and element p takes twiddle p mod m.
+                    const size_t half = 1UL << round;
+                    const Fr* round_roots = root_table[first_round + round - 1];
+                    for (size_t k = 0; k < num_rows; k += 2 * half) {
+                        for (size_t j = 0; j < half; ++j) {
+                            Fr* even = &block[(k + j) << column_log2];
+                            Fr* odd = &block[(k + j + half) << column_log2];
+                            const Fr* twiddles = round_roots + (j << first_round) + column_start;
+                            for (size_t c = 0; c < num_columns; ++c) {
+                                Fr temp = twiddles[c] * odd[c];
+                                odd[c] = even[c] - temp;
+                                even[c] += temp;
+                            }
+                        }
+                    }
+                }
+                for (size_t row = 0; row < num_rows; ++row) {
+                    Fr* dst = out + base + (row << first_round);
+                    const Fr* src = &block[row << column_log2];
+                    for (size_t c = 0; c < num_columns; ++c) {
+                        dst[c] = (last_pass && output_scale != nullptr) ? src[c] * *output_scale : src[c];
+                    }
+                }
+            }
+        });
+        first_round += num_rounds;
     }
 
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            for (size_t i = start; i < end; ++i) {
-                size_t k1 = (i & index_mask) << 1;
-                size_t j1 = i & block_mask;
-                temp = round_roots[j1] * target[k1 + j1 + m];
-                target[k1 + j1 + m] = target[k1 + j1] - temp;
-                target[k1 + j1] += temp;
+    if (single_pass) {
+        for (size_t p = 0; p < num_polys; ++p) {
+            if (work[p] != targets[p]) {
+                std::copy(work[p], work[p] + domain.size, targets[p]);
             }
-        });
+        }
     }
 }
 
+/**
+ * @brief Radix-2 FFT of `coeffs` into `target` (which may be `coeffs`), see fft_blocked_batch.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_blocked(const Fr* coeffs,
+                 Fr* target,
+                 const EvaluationDomain<Fr>& domain,
+                 const std::vector<Fr*>& root_table,
+                 const CosetScaling<Fr>* scaling = nullptr,
+                 const Fr* output_scale = nullptr)
+{
+    fft_blocked_batch<Fr>({ &coeffs, 1 }, { &target, 1 }, domain.size, domain, root_table, scaling, output_scale);
+}
+
+} // namespace
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void partial_fft_serial_inner(Fr* coeffs,
@@ -524,14 +691,14 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
+    fft_blocked(coeffs, coeffs, domain, domain.get_round_roots());
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, target, domain, domain.root, domain.get_round_roots());
+    fft_blocked(coeffs, target, domain, domain.get_round_roots());
 }
 
 template <typename Fr>
@@ -545,20 +712,14 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= domain.domain_inverse;
-    ITERATE_OVER_DOMAIN_END;
+    fft_blocked<Fr>(coeffs, coeffs, domain, domain.get_inverse_round_roots(), nullptr, &domain.domain_inverse);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, target, domain, domain.root_inverse, domain.get_inverse_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    target[i] *= domain.domain_inverse;
-    ITERATE_OVER_DOMAIN_END;
+    fft_blocked<Fr>(coeffs, target, domain, domain.get_inverse_round_roots(), nullptr, &domain.domain_inverse);
 }
 
 template <typename Fr>
@@ -583,26 +744,23 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= value;
-    ITERATE_OVER_DOMAIN_END;
+    fft_blocked<Fr>(coeffs, coeffs, domain, domain.get_round_roots(), nullptr, &value);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    scale_by_generator(coeffs, coeffs, domain, Fr::one(), domain.generator, domain.generator_size);
-    fft(coeffs, domain);
+    const CosetScaling<Fr> scaling{ Fr::one(), domain.generator, domain.generator_size };
+    fft_blocked(coeffs, coeffs, domain, domain.get_round_roots(), &scaling);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
-    scale_by_generator(coeffs, target, domain, Fr::one(), domain.generator, domain.generator_size);
-    fft(coeffs, target, domain);
+    const CosetScaling<Fr> scaling{ Fr::one(), domain.generator, domain.generator_size };
+    fft_blocked(coeffs, target, domain, domain.get_round_roots(), &scaling);
 }
 
 template <typename Fr>
@@ -645,16 +803,10 @@ void coset_fft(Fr* coeffs,
     for (size_t i = 1; i < domain_extension; ++i) {
         coset_generators[i] = coset_generators[i - 1] * primitive_root;
     }
-    for (size_t i = domain_extension - 1; i < domain_extension; --i) {
-        scale_by_generator(coeffs, coeffs + (i * domain.size), domain, Fr::one(), coset_generators[i], domain.size);
-    }
-
+    // Each coset reads the coefficients straight from the first domain.size entries, scaling them as it goes.
     for (size_t i = 0; i < domain_extension; ++i) {
-        fft_inner_parallel(coeffs + (i * domain.size),
-                           scratch_space + (i * domain.size),
-                           domain,
-                           domain.root,
-                           domain.get_round_roots());
+        const CosetScaling<Fr> scaling{ Fr::one(), coset_generators[i], domain.size };
+        fft_blocked(coeffs, scratch_space + (i * domain.size), domain, domain.get_round_roots(), &scaling);
     }
 
     if (domain_extension == 4) {
@@ -668,12 +820,6 @@ void coset_fft(Fr* coeffs,
                 Fr::__copy(scratch_space[i + (3UL << domain.log2_size)], coeffs[(i << 2UL) + 3UL]);
             }
         });
-
-        for (size_t i = 0; i < domain.size; ++i) {
-            for (size_t j = 0; j < domain_extension; ++j) {
-                Fr::__copy(scratch_space[i + (j << domain.log2_size)], coeffs[(i << log2_domain_extension) + j]);
-            }
-        }
     } else {
         for (size_t i = 0; i < domain.size; ++i) {
             for (size_t j = 0; j < domain_extension; ++j) {
@@ -687,28 +833,56 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& constant)
 {
-    Fr start = constant;
-    scale_by_generator(coeffs, coeffs, domain, start, domain.generator, domain.generator_size);
-    fft(coeffs, domain);
+    const CosetScaling<Fr> scaling{ constant, domain.generator, domain.generator_size };
+    fft_blocked(coeffs, coeffs, domain, domain.get_round_roots(), &scaling);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft_with_generator_shift(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& constant)
 {
-    scale_by_generator(coeffs, coeffs, domain, Fr::one(), domain.generator * constant, domain.generator_size);
-    fft(coeffs, domain);
+    const CosetScaling<Fr> scaling{ Fr::one(), domain.generator * constant, domain.generator_size };
+    fft_blocked(coeffs, coeffs, domain, domain.get_round_roots(), &scaling);
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
-    Fr T0 = domain.domain_inverse * value;
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= T0;
-    ITERATE_OVER_DOMAIN_END;
+    const Fr T0 = domain.domain_inverse * value;
+    fft_blocked<Fr>(coeffs, coeffs, domain, domain.get_inverse_round_roots(), nullptr, &T0);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(const std::vector<const Fr*>& coeffs,
+               const std::vector<Fr*>& targets,
+               const size_t num_coeffs,
+               const EvaluationDomain<Fr>& domain)
+{
+    fft_blocked_batch<Fr>(coeffs, targets, num_coeffs, domain, domain.get_round_roots());
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(const std::vector<const Fr*>& coeffs,
+                     const std::vector<Fr*>& targets,
+                     const size_t num_coeffs,
+                     const EvaluationDomain<Fr>& domain)
+{
+    const CosetScaling<Fr> scaling{ Fr::one(), domain.generator, domain.generator_size };
+    fft_blocked_batch<Fr>(coeffs, targets, num_coeffs, domain, domain.get_round_roots(), &scaling);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void ifft_batch(const std::vector<const Fr*>& coeffs,
+                const std::vector<Fr*>& targets,
+                const size_t num_coeffs,
+                const EvaluationDomain<Fr>& domain)
+{
+    fft_blocked_batch<Fr>(
+        coeffs, targets, num_coeffs, domain, domain.get_inverse_round_roots(), nullptr, &domain.domain_inverse);
 }
 
 template <typename Fr>
@@ -1385,6 +1559,18 @@ template void ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void ifft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
+template void fft_batch<fr>(const std::vector<const fr*>&,
+                           const std::vector<fr*>&,
+                           size_t,
+                           const EvaluationDomain<fr>&);
+template void coset_fft_batch<fr>(const std::vector<const fr*>&,
+                                 const std::vector<fr*>&,
+                                 size_t,
+                                 const EvaluationDomain<fr>&);
+template void ifft_batch<fr>(const std::vector<const fr*>&,
+                            const std::vector<fr*>&,
+                            size_t,
+                            const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
@@ -89,6 +89,28 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value);
 
+// Batched transforms of several same-sized polynomials, which share each pass over the data (and its twiddles) rather
+// than making one pass per polynomial. coeffs[i] holds the first num_coeffs coefficients of polynomial i, the rest are
+// taken to be zero, and the result goes to targets[i] (which may be coeffs[i], at the cost of a scratch buffer).
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(const std::vector<const Fr*>& coeffs,
+               const std::vector<Fr*>& targets,
+               size_t num_coeffs,
+               const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(const std::vector<const Fr*>& coeffs,
+                     const std::vector<Fr*>& targets,
+                     size_t num_coeffs,
+                     const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void ifft_batch(const std::vector<const Fr*>& coeffs,
+                const std::vector<Fr*>& targets,
+                size_t num_coeffs,
+                const EvaluationDomain<Fr>& domain);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain);
@@ -398,6 +420,18 @@ extern template void ifft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void ifft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 extern template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 extern template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
+extern template void fft_batch<fr>(const std::vector<const fr*>&,
+                                  const std::vector<fr*>&,
+                                  size_t,
+                                  const EvaluationDomain<fr>&);
+extern template void coset_fft_batch<fr>(const std::vector<const fr*>&,
+                                        const std::vector<fr*>&,
+                                        size_t,
+                                        const EvaluationDomain<fr>&);
+extern template void ifft_batch<fr>(const std::vector<const fr*>&,
+                                   const std::vector<fr*>&,
+                                   size_t,
+                                   const EvaluationDomain<fr>&);
 extern template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 extern template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
@@ -136,6 +136,99 @@ TEST(polynomials, basic_fft)
     aligned_free(data);
 }
 
+/**
+ * @brief Check the blocked fft against direct evaluation at sizes that take one, two and three passes over the data,
+ * both in place and out of place, and the coset fft with a partially applied coset generator.
+ */
+TEST(polynomials, fft_multi_pass)
+{
+    for (const size_t log_n : { 11UL, 13UL, 17UL, 21UL }) {
+        const size_t n = size_t(1) << log_n;
+        auto domain = evaluation_domain(n, n / 4);
+        domain.compute_lookup_table();
+        // Drawing 2^21 random elements is slow, so the coefficients follow a random recurrence instead.
+        auto poly = polynomial(n);
+        const fr multiplier = fr::random_element();
+        const fr addend = fr::random_element();
+        poly[0] = fr::random_element();
+        for (size_t i = 1; i < n; ++i) {
+            poly[i] = poly[i - 1] * multiplier + addend;
+        }
+        polynomial in_place(poly);
+        auto out_of_place = polynomial(n);
+        polynomial coset(poly);
+        polynomial_arithmetic::fft(&in_place[0], domain);
+        polynomial_arithmetic::fft(&poly[0], &out_of_place[0], domain);
+        polynomial_arithmetic::coset_fft(&coset[0], domain);
+
+        // The coset generator applies to the first n / 4 coefficients only.
+        polynomial shifted(poly);
+        fr shift = fr::one();
+        for (size_t i = 0; i < n / 4; ++i) {
+            shifted[i] *= shift;
+            shift *= domain.generator;
+        }
+        for (const size_t index : { size_t(0), size_t(1), n / 2 + 3, n - 1 }) {
+            const fr point = domain.root.pow(index);
+            EXPECT_EQ(in_place[index], polynomial_arithmetic::evaluate(&poly[0], point, n));
+            EXPECT_EQ(out_of_place[index], in_place[index]);
+            EXPECT_EQ(coset[index], polynomial_arithmetic::evaluate(&shifted[0], point, n));
+        }
+
+        polynomial_arithmetic::ifft(&in_place[0], domain);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(in_place[i], poly[i]);
+        }
+    }
+}
+
+/**
+ * @brief The batched transforms match one transform per polynomial, for zero-padded inputs and in-place targets.
+ */
+TEST(polynomials, fft_batch)
+{
+    constexpr size_t num_polys = 3;
+    for (const size_t log_n : { 4UL, 14UL, 17UL }) {
+        const size_t n = size_t(1) << log_n;
+        const size_t num_coeffs = n / 4;
+        auto domain = evaluation_domain(n, num_coeffs);
+        domain.compute_lookup_table();
+
+        std::vector<polynomial> inputs;
+        for (size_t p = 0; p < num_polys; ++p) {
+            inputs.emplace_back(num_coeffs);
+            for (size_t i = 0; i < num_coeffs; ++i) {
+                inputs[p][i] = fr::random_element();
+            }
+        }
+
+        auto check = [&](auto batch, auto single) {
+            // The last polynomial is transformed in place.
+            std::vector<polynomial> targets;
+            std::vector<const fr*> coeffs;
+            std::vector<fr*> target_ptrs;
+            for (size_t p = 0; p < num_polys; ++p) {
+                const bool in_place = p + 1 == num_polys;
+                targets.emplace_back(in_place ? polynomial(inputs[p], n) : polynomial(n));
+                coeffs.push_back(in_place ? &targets[p][0] : &inputs[p][0]);
+                target_ptrs.push_back(&targets[p][0]);
+            }
+            batch(coeffs, target_ptrs, num_coeffs, domain);
+            for (size_t p = 0; p < num_polys; ++p) {
+                polynomial expected(inputs[p], n);
+                single(&expected[0], domain);
+                EXPECT_EQ(targets[p], expected);
+            }
+        };
+        check(polynomial_arithmetic::fft_batch<fr>,
+              [](fr* coeffs, auto& domain) { polynomial_arithmetic::fft(coeffs, domain); });
+        check(polynomial_arithmetic::coset_fft_batch<fr>,
+              [](fr* coeffs, auto& domain) { polynomial_arithmetic::coset_fft(coeffs, domain); });
+        check(polynomial_arithmetic::ifft_batch<fr>,
+              [](fr* coeffs, auto& domain) { polynomial_arithmetic::ifft(coeffs, domain); });
+    }
+}
+
 TEST(polynomials, fft_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/ecc/fields/field_lanes.hpp"
 #include "barretenberg/polynomials/barycentric.hpp"
 #include <span>
 
@@ -83,6 +84,11 @@ template <class Fr, size_t domain_end, size_t domain_start = 0> class Univariate
 
     static Univariate random_element() { return get_random(); };
 
+    bool is_zero() const
+    {
+        return std::all_of(evaluations.begin(), evaluations.end(), [](const Fr& value) { return value.is_zero(); });
+    }
+
     // Operations between Univariate and other Univariate
     bool operator==(const Univariate& other) const = default;
 
@@ -277,6 +283,16 @@ template <class Fr, size_t domain_end, size_t domain_start = 0> class Univariate
             }
             return result;
         } else {
+            if constexpr (field_lanes::has_vector_kernels<Fr> && domain_start == 0 && EXTENDED_LENGTH > LENGTH) {
+                // The same sums, one new point per lane.
+                field_lanes::barycentric_extend(&evaluations[0],
+                                                LENGTH,
+                                                &Data::precomputed_denominator_inverses[LENGTH * LENGTH],
+                                                &Data::full_numerator_values[LENGTH],
+                                                &result.evaluations[LENGTH],
+                                                EXTENDED_LENGTH - LENGTH);
+                return result;
+            }
             for (size_t k = domain_end; k != EXTENDED_DOMAIN_END; ++k) {
                 result.value_at(k) = 0;
                 // compute each term v_j / (d_j*(x-x_j)) of the sum
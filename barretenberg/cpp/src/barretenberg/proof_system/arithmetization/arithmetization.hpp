@@ -96,6 +96,16 @@ template <typename FF_> class Ultra {
         }
     }
 
+    /**
+     * @brief Resize all selectors, padding with zeros
+     */
+    void resize(size_t new_size)
+    {
+        for (auto& vec : selectors) {
+            vec.resize(new_size, 0);
+        }
+    }
+
     /**
      * @brief Add zeros to all selectors which are not part of the conventional Ultra arithmetization
      * @details Does nothing for this class since this IS the conventional Ultra arithmetization
@@ -148,6 +158,16 @@ template <typename FF_> class UltraHonk {
         }
     }
 
+    /**
+     * @brief Resize all selectors, padding with zeros
+     */
+    void resize(size_t new_size)
+    {
+        for (auto& vec : selectors) {
+            vec.resize(new_size, 0);
+        }
+    }
+
     /**
      * @brief Add zeros to all selectors which are not part of the conventional Ultra arithmetization
      * @details Facilitates reuse of Ultra gate construction functions in arithmetizations which extend the conventional
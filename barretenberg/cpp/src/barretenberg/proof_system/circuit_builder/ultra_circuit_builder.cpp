@@ -6,7 +6,9 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
+#include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -578,16 +580,15 @@ uint32_t UltraCircuitBuilder_<Arithmetization>::put_constant_variable(const FF&
 }
 
 template <typename Arithmetization>
-plookup::BasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
+plookup::CircuitBasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
 {
-    for (plookup::BasicTable& table : lookup_tables) {
-        if (table.id == id) {
-            return table;
-        }
+    auto& position = lookup_table_positions[static_cast<size_t>(id)];
+    if (position == 0) {
+        // First use of the table in this circuit: reference the shared table data, creating it if need be.
+        lookup_tables.emplace_back(plookup::get_basic_table(id), lookup_tables.size());
+        position = lookup_tables.size();
     }
-    // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
-    return lookup_tables[lookup_tables.size() - 1];
+    return lookup_tables[position - 1];
 }
 
 /**
@@ -845,7 +846,14 @@ void UltraCircuitBuilder_<Arithmetization>::create_new_range_constraint(const ui
     }
 }
 
-template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_list(RangeList& list)
+/**
+ * @brief Replace the witness indices of a range list by their real variable indices, remove duplicates and return the
+ * sorted values of the remaining witnesses
+ *
+ * @details Only `list` is modified, so different lists can be sorted concurrently.
+ */
+template <typename Arithmetization>
+std::vector<uint32_t> UltraCircuitBuilder_<Arithmetization>::sort_range_list(RangeList& list)
 {
     this->assert_valid_variables(list.variable_indices);
 
@@ -878,32 +886,82 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
 #else
     std::sort(std::execution::par_unseq, sorted_list.begin(), sorted_list.end());
 #endif
-    // list must be padded to a multipe of 4 and larger than 4 (gate_width)
-    constexpr size_t gate_width = NUM_WIRES;
-    size_t padding = (gate_width - (list.variable_indices.size() % gate_width)) % gate_width;
-
-    std::vector<uint32_t> indices;
-    indices.reserve(padding + sorted_list.size());
+    return sorted_list;
+}
 
-    if (list.variable_indices.size() <= gate_width) {
-        padding += gate_width;
-    }
-    for (size_t i = 0; i < padding; ++i) {
-        indices.emplace_back(this->zero_idx);
-    }
-    for (const auto sorted_value : sorted_list) {
-        const uint32_t index = this->add_variable(sorted_value);
-        assign_tag(index, list.tau_tag);
-        indices.emplace_back(index);
-    }
-    create_sort_constraint_with_edges(indices, 0, list.target_range);
+template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_list(RangeList& list)
+{
+    process_range_lists({ &list });
 }
 
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_lists()
 {
+    std::vector<RangeList*> lists;
+    lists.reserve(range_lists.size());
     for (auto& i : range_lists) {
-        process_range_list(i.second);
+        lists.emplace_back(&i.second);
     }
+    process_range_lists(lists);
+}
+
+/**
+ * @brief Create the sorted copies of the variables in each list and the sort constraints over them
+ *
+ * @details The lists are sorted concurrently. Every list then takes a segment of the new variables and of the new
+ * gates, in the order in which the lists are given, and the segments are filled concurrently. The resulting circuit is
+ * the same as when the lists are processed one after another.
+ */
+template <typename Arithmetization>
+void UltraCircuitBuilder_<Arithmetization>::process_range_lists(const std::vector<RangeList*>& lists)
+{
+    constexpr size_t gate_width = NUM_WIRES;
+    const size_t num_lists = lists.size();
+
+    std::vector<std::vector<uint32_t>> sorted_lists(num_lists);
+    parallel_for(num_lists, [&](size_t i) { sorted_lists[i] = sort_range_list(*lists[i]); });
+
+    std::vector<size_t> padding(num_lists);
+    std::vector<size_t> variable_offsets(num_lists);
+    std::vector<size_t> gate_offsets(num_lists);
+    size_t num_variables = this->variables.size();
+    size_t num_new_gates = 0;
+    for (size_t i = 0; i < num_lists; ++i) {
+        const size_t list_size = sorted_lists[i].size();
+        // list must be padded to a multipe of 4 and larger than 4 (gate_width)
+        padding[i] = (gate_width - (list_size % gate_width)) % gate_width;
+        if (list_size <= gate_width) {
+            padding[i] += gate_width;
+        }
+        variable_offsets[i] = num_variables;
+        gate_offsets[i] = num_new_gates;
+        num_variables += list_size;
+        // one gate per row of the padded list, plus the end condition gate
+        num_new_gates += (padding[i] + list_size) / gate_width + 1;
+    }
+
+    const size_t first_row = add_empty_gates(num_new_gates);
+    this->variables.resize(num_variables);
+    this->real_variable_index.resize(num_variables);
+    this->next_var_index.resize(num_variables, this->REAL_VARIABLE);
+    this->prev_var_index.resize(num_variables, this->FIRST_VARIABLE_IN_CLASS);
+    this->real_variable_tags.resize(num_variables, DUMMY_TAG);
+
+    parallel_for(num_lists, [&](size_t i) {
+        const RangeList& list = *lists[i];
+        std::vector<uint32_t> indices;
+        indices.reserve(padding[i] + sorted_lists[i].size());
+        indices.resize(padding[i], this->zero_idx);
+        auto index = static_cast<uint32_t>(variable_offsets[i]);
+        for (const auto sorted_value : sorted_lists[i]) {
+            // equivalent to add_variable(sorted_value) followed by assign_tag(index, list.tau_tag)
+            this->variables[index] = sorted_value;
+            this->real_variable_index[index] = index;
+            this->real_variable_tags[index] = list.tau_tag;
+            indices.emplace_back(index);
+            ++index;
+        }
+        set_sort_constraint_with_edges(indices, 0, list.target_range, first_row + gate_offsets[i]);
+    });
 }
 
 /*
@@ -1011,85 +1069,68 @@ void UltraCircuitBuilder_<Arithmetization>::create_sort_constraint_with_edges(
     ASSERT(variable_index.size() % gate_width == 0 && variable_index.size() > gate_width);
     this->assert_valid_variables(variable_index);
 
-    // enforce range checks of first row and starting at start
-    w_l.emplace_back(variable_index[0]);
-    w_r.emplace_back(variable_index[1]);
-    w_o.emplace_back(variable_index[2]);
-    w_4.emplace_back(variable_index[3]);
-    ++this->num_gates;
-    q_m.emplace_back(0);
-    q_1.emplace_back(1);
-    q_2.emplace_back(0);
-    q_3.emplace_back(0);
-    q_c.emplace_back(-start);
-    q_arith.emplace_back(1);
-    q_4.emplace_back(0);
-    q_sort.emplace_back(1);
-    q_elliptic.emplace_back(0);
-    q_lookup_type.emplace_back(0);
-    q_aux.emplace_back(0);
-    selectors.pad_additional();
-    // enforce range check for middle rows
-    for (size_t i = gate_width; i < variable_index.size() - gate_width; i += gate_width) {
+    const size_t first_row = add_empty_gates(variable_index.size() / gate_width + 1);
+    set_sort_constraint_with_edges(variable_index, start, end, first_row);
+}
 
-        w_l.emplace_back(variable_index[i]);
-        w_r.emplace_back(variable_index[i + 1]);
-        w_o.emplace_back(variable_index[i + 2]);
-        w_4.emplace_back(variable_index[i + 3]);
-        ++this->num_gates;
-        q_m.emplace_back(0);
-        q_1.emplace_back(0);
-        q_2.emplace_back(0);
-        q_3.emplace_back(0);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
-        q_4.emplace_back(0);
-        q_sort.emplace_back(1);
-        q_elliptic.emplace_back(0);
-        q_lookup_type.emplace_back(0);
-        q_aux.emplace_back(0);
-        selectors.pad_additional();
-    }
-    // enforce range checks of last row and ending at end
-    if (variable_index.size() > gate_width) {
-        w_l.emplace_back(variable_index[variable_index.size() - 4]);
-        w_r.emplace_back(variable_index[variable_index.size() - 3]);
-        w_o.emplace_back(variable_index[variable_index.size() - 2]);
-        w_4.emplace_back(variable_index[variable_index.size() - 1]);
-        ++this->num_gates;
-        q_m.emplace_back(0);
-        q_1.emplace_back(0);
-        q_2.emplace_back(0);
-        q_3.emplace_back(0);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
-        q_4.emplace_back(0);
-        q_sort.emplace_back(1);
-        q_elliptic.emplace_back(0);
-        q_lookup_type.emplace_back(0);
-        q_aux.emplace_back(0);
-        selectors.pad_additional();
-    }
+/**
+ * @brief Write the gates of `create_sort_constraint_with_edges` into the variable_index.size() / 4 + 1 existing empty
+ * gates that start at `first_row`
+ *
+ * @details Nothing outside of these gates is touched, so disjoint blocks of gates can be filled concurrently.
+ */
+template <typename Arithmetization>
+void UltraCircuitBuilder_<Arithmetization>::set_sort_constraint_with_edges(const std::vector<uint32_t>& variable_index,
+                                                                          const FF& start,
+                                                                          const FF& end,
+                                                                          const size_t first_row)
+{
+    constexpr size_t gate_width = NUM_WIRES;
+    const size_t num_sort_rows = variable_index.size() / gate_width;
+
+    // enforce range checks of every row, including the first and last
+    for (size_t i = 0; i < num_sort_rows; ++i) {
+        const size_t row = first_row + i;
+        w_l[row] = variable_index[i * gate_width];
+        w_r[row] = variable_index[i * gate_width + 1];
+        w_o[row] = variable_index[i * gate_width + 2];
+        w_4[row] = variable_index[i * gate_width + 3];
+        q_sort[row] = 1;
+    }
+    // starting at start
+    q_1[first_row] = 1;
+    q_c[first_row] = -start;
+    q_arith[first_row] = 1;
 
     // dummy gate needed because of sort widget's check of next row
     // use this gate to check end condition
-    w_l.emplace_back(variable_index[variable_index.size() - 1]);
-    w_r.emplace_back(this->zero_idx);
-    w_o.emplace_back(this->zero_idx);
-    w_4.emplace_back(this->zero_idx);
-    ++this->num_gates;
-    q_m.emplace_back(0);
-    q_1.emplace_back(1);
-    q_2.emplace_back(0);
-    q_3.emplace_back(0);
-    q_c.emplace_back(-end);
-    q_arith.emplace_back(1);
-    q_4.emplace_back(0);
-    q_sort.emplace_back(0);
-    q_elliptic.emplace_back(0);
-    q_lookup_type.emplace_back(0);
-    q_aux.emplace_back(0);
-    selectors.pad_additional();
+    const size_t end_row = first_row + num_sort_rows;
+    w_l[end_row] = variable_index[variable_index.size() - 1];
+    w_r[end_row] = this->zero_idx;
+    w_o[end_row] = this->zero_idx;
+    w_4[end_row] = this->zero_idx;
+    q_1[end_row] = 1;
+    q_c[end_row] = -end;
+    q_arith[end_row] = 1;
+}
+
+/**
+ * @brief Append `num_new_gates` gates with all selectors set to zero and all wires set to zero_idx
+ *
+ * @return The index of the first new gate
+ */
+template <typename Arithmetization>
+size_t UltraCircuitBuilder_<Arithmetization>::add_empty_gates(const size_t num_new_gates)
+{
+    const size_t first_row = w_l.size();
+    const size_t new_size = first_row + num_new_gates;
+    w_l.resize(new_size, this->zero_idx);
+    w_r.resize(new_size, this->zero_idx);
+    w_o.resize(new_size, this->zero_idx);
+    w_4.resize(new_size, this->zero_idx);
+    selectors.resize(new_size);
+    this->num_gates += num_new_gates;
+    return first_row;
 }
 
 // range constraint a value by decomposing it into limbs whose size should be the default range constraint size
@@ -2400,13 +2441,73 @@ std::array<uint32_t, 2> UltraCircuitBuilder_<Arithmetization>::read_ROM_array_pa
     return value_witnesses;
 }
 
+namespace {
+/**
+ * @brief The positions of `records` in the order std::sort puts the records in
+ *
+ * @details The positions are sorted with the same comparisons as the records would be, so the order is the one that
+ * sorting the records themselves produces, including the order of records that compare equal.
+ */
+template <typename Record> std::vector<uint32_t> get_sorted_order(const std::vector<Record>& records)
+{
+    std::vector<uint32_t> order(records.size());
+    std::iota(order.begin(), order.end(), 0);
+    const auto compare = [&](const uint32_t a, const uint32_t b) { return records[a] < records[b]; };
+#ifdef NO_TBB
+    std::sort(order.begin(), order.end(), compare);
+#else
+    std::sort(std::execution::par_unseq, order.begin(), order.end(), compare);
+#endif
+    return order;
+}
+
+/**
+ * @brief Replace `records` by the records at the positions in `order`
+ */
+template <typename Record> void reorder_records(std::vector<Record>& records, const std::vector<uint32_t>& order)
+{
+    ASSERT(order.size() == records.size());
+    std::vector<Record> sorted_records;
+    sorted_records.reserve(records.size());
+    for (const uint32_t position : order) {
+        sorted_records.emplace_back(records[position]);
+    }
+    records = std::move(sorted_records);
+}
+} // namespace
+
+/**
+ * @brief The order in which process_ROM_array sorts the records of a ROM array
+ *
+ * @details process_ROM_array first initialises any uninitialised cells, each adding one record in cell order, then
+ * sorts the records. The order is computed here from the records' sort keys, as std::sort would sort the records.
+ * This only reads the array, so the orders of all arrays can be computed concurrently before any of them is processed.
+ */
+template <typename Arithmetization>
+std::vector<uint32_t> UltraCircuitBuilder_<Arithmetization>::get_sorted_ROM_record_order(
+    const RomTranscript& rom_array) const
+{
+    std::vector<RomRecord> records = rom_array.records;
+    for (size_t i = 0; i < rom_array.state.size(); ++i) {
+        if (rom_array.state[i][0] == UNINITIALIZED_MEMORY_RECORD) {
+            RomRecord record;
+            record.index = static_cast<uint32_t>(i);
+            records.emplace_back(record);
+        }
+    }
+    return get_sorted_order(records);
+}
+
 /**
  * @brief Compute additional gates required to validate ROM reads. Called when generating the proving key
  *
  * @param rom_id The id of the ROM table
- * @param gate_offset_from_public_inputs Required to track the gate position of where we're adding extra gates
+ * @param sorted_record_order The order of the records once the uninitialised cells are initialised (see
+ * get_sorted_ROM_record_order)
  */
-template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_ROM_array(const size_t rom_id)
+template <typename Arithmetization>
+void UltraCircuitBuilder_<Arithmetization>::process_ROM_array(const size_t rom_id,
+                                                              const std::vector<uint32_t>& sorted_record_order)
 {
 
     auto& rom_array = rom_arrays[rom_id];
@@ -2422,11 +2523,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         }
     }
 
-#ifdef NO_TBB
-    std::sort(rom_array.records.begin(), rom_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, rom_array.records.begin(), rom_array.records.end());
-#endif
+    reorder_records(rom_array.records, sorted_record_order);
 
     for (const RomRecord& record : rom_array.records) {
         const auto index = record.index;
@@ -2486,13 +2583,39 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     // because the first cell is explicitly initialized using zero_idx as the index field.
 }
 
+/**
+ * @brief The order in which process_RAM_array sorts the records of a RAM array
+ *
+ * @details As for get_sorted_ROM_record_order. Each uninitialised cell adds one record, in cell order, with the next
+ * timestamp.
+ */
+template <typename Arithmetization>
+std::vector<uint32_t> UltraCircuitBuilder_<Arithmetization>::get_sorted_RAM_record_order(
+    const RamTranscript& ram_array) const
+{
+    std::vector<RamRecord> records = ram_array.records;
+    size_t access_count = ram_array.access_count;
+    for (size_t i = 0; i < ram_array.state.size(); ++i) {
+        if (ram_array.state[i] == UNINITIALIZED_MEMORY_RECORD) {
+            RamRecord record;
+            record.index = static_cast<uint32_t>(i);
+            record.timestamp = static_cast<uint32_t>(access_count++);
+            records.emplace_back(record);
+        }
+    }
+    return get_sorted_order(records);
+}
+
 /**
  * @brief Compute additional gates required to validate RAM read/writes. Called when generating the proving key
  *
  * @param ram_id The id of the RAM table
- * @param gate_offset_from_public_inputs Required to track the gate position of where we're adding extra gates
+ * @param sorted_record_order The order of the records once the uninitialised cells are initialised (see
+ * get_sorted_RAM_record_order)
  */
-template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_RAM_array(const size_t ram_id)
+template <typename Arithmetization>
+void UltraCircuitBuilder_<Arithmetization>::process_RAM_array(const size_t ram_id,
+                                                              const std::vector<uint32_t>& sorted_record_order)
 {
     RamTranscript& ram_array = ram_arrays[ram_id];
     const auto access_tag = get_new_tag();      // current_tag + 1;
@@ -2510,11 +2633,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         }
     }
 
-#ifdef NO_TBB
-    std::sort(ram_array.records.begin(), ram_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, ram_array.records.begin(), ram_array.records.end());
-#endif
+    reorder_records(ram_array.records, sorted_record_order);
 
     std::vector<RamRecord> sorted_ram_records;
 
@@ -2632,16 +2751,30 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     }
 }
 
+/**
+ * @brief Process every ROM array. The arrays' records are sorted concurrently, then their gates are added one array at
+ * a time, as they interleave with the creation of tags and variables.
+ */
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_ROM_arrays()
 {
+    std::vector<std::vector<uint32_t>> sorted_record_orders(rom_arrays.size());
+    parallel_for(rom_arrays.size(),
+                 [&](size_t i) { sorted_record_orders[i] = get_sorted_ROM_record_order(rom_arrays[i]); });
     for (size_t i = 0; i < rom_arrays.size(); ++i) {
-        process_ROM_array(i);
+        process_ROM_array(i, sorted_record_orders[i]);
     }
 }
+
+/**
+ * @brief Process every RAM array, sorting their records concurrently as in process_ROM_arrays
+ */
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_RAM_arrays()
 {
+    std::vector<std::vector<uint32_t>> sorted_record_orders(ram_arrays.size());
+    parallel_for(ram_arrays.size(),
+                 [&](size_t i) { sorted_record_orders[i] = get_sorted_RAM_record_order(ram_arrays[i]); });
     for (size_t i = 0; i < ram_arrays.size(); ++i) {
-        process_RAM_array(i);
+        process_RAM_array(i, sorted_record_orders[i]);
     }
 }
 
@@ -556,7 +556,9 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     // TODO(#216)(Adrian): Why is this not in CircuitBuilderBase
     std::map<FF, uint32_t> constant_variable_indices;
 
-    std::vector<plookup::BasicTable> lookup_tables;
+    std::vector<plookup::CircuitBasicTable> lookup_tables;
+    // One more than the position in `lookup_tables` of each basic table used by the circuit, or 0 if it is unused
+    std::array<size_t, plookup::BasicTableId::NUM_BASIC_TABLES> lookup_table_positions{};
     std::vector<plookup::MultiTable> lookup_multi_tables;
     std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
 
@@ -607,6 +609,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
         constant_variable_indices = other.constant_variable_indices;
 
         lookup_tables = other.lookup_tables;
+        lookup_table_positions = other.lookup_table_positions;
         lookup_multi_tables = other.lookup_multi_tables;
         range_lists = other.range_lists;
         ram_arrays = other.ram_arrays;
@@ -625,6 +628,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
         constant_variable_indices = other.constant_variable_indices;
 
         lookup_tables = other.lookup_tables;
+        lookup_table_positions = other.lookup_table_positions;
         lookup_multi_tables = other.lookup_multi_tables;
         range_lists = other.range_lists;
         ram_arrays = other.ram_arrays;
@@ -879,7 +883,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
                                       bool (*generator)(std::vector<FF>&, std::vector<FF>&, std::vector<FF>&),
                                       std::array<FF, 2> (*get_values_from_key)(const std::array<uint64_t, 2>));
 
-    plookup::BasicTable& get_table(const plookup::BasicTableId id);
+    plookup::CircuitBasicTable& get_table(const plookup::BasicTableId id);
     plookup::MultiTable& create_table(const plookup::MultiTableId id);
 
     plookup::ReadData<uint32_t> create_gates_from_plookup_accumulators(
@@ -903,6 +907,11 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     void create_dummy_constraints(const std::vector<uint32_t>& variable_index);
     void create_sort_constraint(const std::vector<uint32_t>& variable_index);
     void create_sort_constraint_with_edges(const std::vector<uint32_t>& variable_index, const FF&, const FF&);
+    void set_sort_constraint_with_edges(const std::vector<uint32_t>& variable_index,
+                                        const FF& start,
+                                        const FF& end,
+                                        const size_t first_row);
+    size_t add_empty_gates(const size_t num_new_gates);
     void assign_tag(const uint32_t variable_index, const uint32_t tag)
     {
         ASSERT(tag <= this->current_tag);
@@ -928,8 +937,10 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     }
 
     RangeList create_range_list(const uint64_t target_range);
+    std::vector<uint32_t> sort_range_list(RangeList& list);
     void process_range_list(RangeList& list);
     void process_range_lists();
+    void process_range_lists(const std::vector<RangeList*>& lists);
 
     /**
      * Custom Gate Selectors
@@ -976,7 +987,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     std::array<uint32_t, 2> read_ROM_array_pair(const size_t rom_id, const uint32_t index_witness);
     void create_ROM_gate(RomRecord& record);
     void create_sorted_ROM_gate(RomRecord& record);
-    void process_ROM_array(const size_t rom_id);
+    std::vector<uint32_t> get_sorted_ROM_record_order(const RomTranscript& rom_array) const;
+    void process_ROM_array(const size_t rom_id, const std::vector<uint32_t>& sorted_record_order);
     void process_ROM_arrays();
 
     void create_RAM_gate(RamRecord& record);
@@ -987,7 +999,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     void init_RAM_element(const size_t ram_id, const size_t index_value, const uint32_t value_witness);
     uint32_t read_RAM_array(const size_t ram_id, const uint32_t index_witness);
     void write_RAM_array(const size_t ram_id, const uint32_t index_witness, const uint32_t value_witness);
-    void process_RAM_array(const size_t ram_id);
+    std::vector<uint32_t> get_sorted_RAM_record_order(const RamTranscript& ram_array) const;
+    void process_RAM_array(const size_t ram_id, const std::vector<uint32_t>& sorted_record_order);
     void process_RAM_arrays();
 
     // Circuit evaluation methods
@@ -75,6 +75,50 @@ TEST(ultra_circuit_constructor, create_gates_from_plookup_accumulators)
     EXPECT_TRUE(saved_state.is_same_state(circuit_builder));
 }
 
+TEST(ultra_circuit_constructor, lookup_tables_are_shared_between_circuits)
+{
+    UltraCircuitBuilder builder_a = UltraCircuitBuilder();
+    UltraCircuitBuilder builder_b = UltraCircuitBuilder();
+
+    // Use the tables in a different order, so that they have different indices in the two circuits
+    builder_a.get_table(plookup::BasicTableId::UINT_XOR_ROTATE0);
+    builder_a.get_table(plookup::BasicTableId::UINT_AND_ROTATE0);
+    builder_b.get_table(plookup::BasicTableId::UINT_AND_ROTATE0);
+    auto& table_a = builder_a.get_table(plookup::BasicTableId::UINT_AND_ROTATE0);
+    auto& table_b = builder_b.get_table(plookup::BasicTableId::UINT_AND_ROTATE0);
+    table_a.lookup_gates.push_back({});
+
+    EXPECT_EQ(builder_a.lookup_tables.size(), 2UL);
+    EXPECT_EQ(builder_b.lookup_tables.size(), 1UL);
+    EXPECT_EQ(table_a.table_index, 1UL);
+    EXPECT_EQ(table_b.table_index, 0UL);
+    EXPECT_EQ(table_a.column_1.data(), table_b.column_1.data());
+    EXPECT_EQ(table_b.lookup_gates.size(), 0UL);
+}
+
+TEST(ultra_circuit_constructor, lookup_tables_are_generated_once_under_concurrent_use)
+{
+    // Threads ask for the same few tables at once: each table must be generated exactly once, and no thread may see a
+    // table before it is complete.
+    const std::array<plookup::BasicTableId, 3> ids = { plookup::BasicTableId::UINT_XOR_ROTATE0,
+                                                       plookup::BasicTableId::UINT_AND_ROTATE0,
+                                                       plookup::BasicTableId::BN254_XLO_BASIC };
+    constexpr size_t NUM_THREADS = 12;
+    std::vector<const plookup::BasicTable*> tables(NUM_THREADS);
+    std::vector<size_t> sizes(NUM_THREADS);
+    parallel_for(NUM_THREADS, [&](size_t i) {
+        const auto& table = plookup::get_basic_table(ids[i % ids.size()]);
+        tables[i] = &table;
+        sizes[i] = table.column_1.size();
+    });
+    for (size_t i = 0; i < NUM_THREADS; ++i) {
+        const auto& table = plookup::get_basic_table(ids[i % ids.size()]);
+        EXPECT_EQ(tables[i], &table);
+        EXPECT_EQ(sizes[i], table.size);
+        EXPECT_GT(sizes[i], 0UL);
+    }
+}
+
 TEST(ultra_circuit_constructor, base_case)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -744,6 +788,122 @@ TEST(ultra_circuit_constructor, ram)
     EXPECT_TRUE(saved_state.is_same_state(circuit_constructor));
 }
 
+/**
+ * @brief The range lists are processed concurrently. The finalised circuit must be the one produced by processing them
+ * one after another with create_sort_constraint_with_edges, as finalize_circuit used to.
+ */
+TEST(ultra_circuit_constructor, range_lists_match_serial_processing)
+{
+    // Lists of 1 to 8 values, around the gate width at which lists get an extra row of padding, and longer lists
+    std::vector<std::pair<uint64_t, std::vector<fr>>> lists;
+    for (size_t list_idx = 0; list_idx < 24; ++list_idx) {
+        const uint64_t target_range = 7 + 13 * list_idx;
+        const size_t num_values = list_idx < 8 ? list_idx + 1 : 7 * list_idx;
+        std::vector<fr> values;
+        for (size_t i = 0; i < num_values; ++i) {
+            values.emplace_back(engine.get_random_uint64() % (target_range + 1));
+        }
+        lists.emplace_back(target_range, values);
+    }
+    const auto build_circuit = [&](UltraCircuitBuilder& builder) {
+        for (const auto& [target_range, values] : lists) {
+            for (size_t i = 0; i < values.size(); ++i) {
+                const uint32_t idx = builder.add_variable(values[i]);
+                // Use each value in a gate, so that it is not an orphan in the sorted set
+                builder.create_add_gate({ idx, builder.zero_idx, builder.zero_idx, 1, 0, 0, -values[i] });
+                builder.create_new_range_constraint(idx, target_range);
+                // Copies of one value in a list are counted once
+                if (i % 5 == 4) {
+                    const uint32_t copy_idx = builder.add_variable(values[i]);
+                    builder.create_new_range_constraint(copy_idx, target_range);
+                    builder.assert_equal(copy_idx, idx);
+                }
+            }
+        }
+    };
+    UltraCircuitBuilder builder = UltraCircuitBuilder();
+    UltraCircuitBuilder serial_builder = UltraCircuitBuilder();
+    build_circuit(builder);
+    build_circuit(serial_builder);
+
+    builder.finalize_circuit();
+
+    serial_builder.process_non_native_field_multiplications();
+    serial_builder.process_ROM_arrays();
+    serial_builder.process_RAM_arrays();
+    for (auto& [target_range, list] : serial_builder.range_lists) {
+        const auto sorted_list = serial_builder.sort_range_list(list);
+        size_t padding = (4 - (sorted_list.size() % 4)) % 4;
+        if (sorted_list.size() <= 4) {
+            padding += 4;
+        }
+        std::vector<uint32_t> indices(padding, serial_builder.zero_idx);
+        for (const uint32_t sorted_value : sorted_list) {
+            const uint32_t index = serial_builder.add_variable(sorted_value);
+            serial_builder.assign_tag(index, list.tau_tag);
+            indices.emplace_back(index);
+        }
+        serial_builder.create_sort_constraint_with_edges(indices, 0, target_range);
+    }
+    serial_builder.circuit_finalized = true;
+
+    auto serial_state = UltraCircuitBuilder::CircuitDataBackup::store_full_state(serial_builder);
+    EXPECT_TRUE(serial_state.is_same_state(builder));
+    EXPECT_TRUE(builder.check_circuit());
+}
+
+/**
+ * @brief The ROM and RAM records are ordered concurrently, before process_ROM_array and process_RAM_array initialise
+ * the remaining cells. The order must be the one std::sort gives the records once those cells are initialised,
+ * including the order of repeated reads of one ROM cell.
+ */
+TEST(ultra_circuit_constructor, memory_record_order_matches_sort)
+{
+    UltraCircuitBuilder builder = UltraCircuitBuilder();
+
+    // Only the even cells are initialised, and there are enough reads for std::sort to partition them
+    constexpr size_t ARRAY_SIZE = 40;
+    constexpr size_t NUM_ACCESSES = 200;
+    const size_t rom_id = builder.create_ROM_array(ARRAY_SIZE);
+    const size_t ram_id = builder.create_RAM_array(ARRAY_SIZE);
+    for (size_t i = 0; i < ARRAY_SIZE; i += 2) {
+        builder.set_ROM_element(rom_id, i, builder.add_variable(fr::random_element()));
+        builder.init_RAM_element(ram_id, i, builder.add_variable(fr::random_element()));
+    }
+    for (size_t i = 0; i < NUM_ACCESSES; ++i) {
+        const auto index = static_cast<uint32_t>(2 * (engine.get_random_uint32() % (ARRAY_SIZE / 2)));
+        builder.read_ROM_array(rom_id, builder.add_variable(index));
+        if (i % 3 == 0) {
+            builder.write_RAM_array(ram_id, builder.add_variable(index), builder.add_variable(fr::random_element()));
+        } else {
+            builder.read_RAM_array(ram_id, builder.add_variable(index));
+        }
+    }
+
+    const auto rom_order = builder.get_sorted_ROM_record_order(builder.rom_arrays[rom_id]);
+    const auto ram_order = builder.get_sorted_RAM_record_order(builder.ram_arrays[ram_id]);
+
+    for (size_t i = 1; i < ARRAY_SIZE; i += 2) {
+        builder.set_ROM_element_pair(rom_id, i, { builder.zero_idx, builder.zero_idx });
+        builder.init_RAM_element(ram_id, i, builder.zero_idx);
+    }
+    auto sorted_rom_records = builder.rom_arrays[rom_id].records;
+    auto sorted_ram_records = builder.ram_arrays[ram_id].records;
+    std::sort(sorted_rom_records.begin(), sorted_rom_records.end());
+    std::sort(sorted_ram_records.begin(), sorted_ram_records.end());
+
+    ASSERT_EQ(rom_order.size(), sorted_rom_records.size());
+    for (size_t i = 0; i < rom_order.size(); ++i) {
+        EXPECT_TRUE(builder.rom_arrays[rom_id].records[rom_order[i]] == sorted_rom_records[i]) << "ROM record " << i;
+    }
+    ASSERT_EQ(ram_order.size(), sorted_ram_records.size());
+    for (size_t i = 0; i < ram_order.size(); ++i) {
+        EXPECT_TRUE(builder.ram_arrays[ram_id].records[ram_order[i]] == sorted_ram_records[i]) << "RAM record " << i;
+    }
+
+    EXPECT_TRUE(builder.check_circuit());
+}
+
 TEST(ultra_circuit_constructor, range_checks_on_duplicates)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -7,6 +7,9 @@
  */
 #pragma once
 
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
@@ -17,6 +20,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <numeric>
+#include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -27,7 +33,7 @@ namespace proof_system {
 
 /**
  * @brief cycle_node represents the index of a value of the circuit.
- * It will belong to a CyclicPermutation, such that all nodes in a CyclicPermutation
+ * It will belong to one cycle of the CopyCycles, such that all nodes in a cycle
  * must have the value.
  * The total number of constraints is always <2^32 since that is the type used to represent variables, so we can save
  * space by using a type smaller than size_t.
@@ -56,67 +62,87 @@ template <size_t NUM_WIRES> struct PermutationMapping {
     Mapping ids;
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a circuit, stored as two flat arrays in compressed sparse row form
+ *
+ * @details There is one cycle per variable of the circuit. The nodes of cycle i are nodes[offsets[i]], ...,
+ * nodes[offsets[i + 1] - 1], in the order in which they appear in the execution trace.
+ */
+struct CopyCycles {
+    std::vector<uint32_t> offsets;
+    std::vector<cycle_node> nodes;
+
+    size_t size() const { return offsets.size() - 1; }
+    std::span<const cycle_node> operator[](const size_t cycle_index) const
+    {
+        return { nodes.data() + offsets[cycle_index], nodes.data() + offsets[cycle_index + 1] };
+    }
+};
 
 namespace {
 
 /**
- * @brief Compute all CyclicPermutations of the circuit. Each CyclicPermutation represents the indices of the values in
- * the witness wires that must have the same value.    using Curve = curve::BN254;
-    using FF = Curve::ScalarField;
-    using Polynomial = barretenberg::Polynomial<FF>;
+ * @brief Compute all copy cycles of the circuit. Each cycle represents the indices of the values in the witness wires
+ * that must have the same value.
  *
- * @tparam program_width Program width
+ * @details The nodes are first listed in execution trace order, along with the variable each one holds, and are then
+ * bucketed by variable with a counting sort. Besides avoiding one allocation per variable, this keeps the nodes of
+ * every cycle in execution trace order.
  *
+ * @tparam Flavor
  * */
 template <typename Flavor>
-std::vector<CyclicPermutation> compute_wire_copy_cycles(const typename Flavor::CircuitBuilder& circuit_constructor)
+CopyCycles compute_wire_copy_cycles(const typename Flavor::CircuitBuilder& circuit_constructor)
 {
     // Reference circuit constructor members
     const size_t num_gates = circuit_constructor.num_gates;
     std::span<const uint32_t> public_inputs = circuit_constructor.public_inputs;
     const size_t num_public_inputs = public_inputs.size();
+    const size_t num_wires = circuit_constructor.wires.size();
 
     // Each variable represents one cycle
     const size_t number_of_cycles = circuit_constructor.variables.size();
-    std::vector<CyclicPermutation> copy_cycles(number_of_cycles);
-    copy_cycles.reserve(num_gates * 3);
 
     // Represents the index of a variable in circuit_constructor.variables
     std::span<const uint32_t> real_variable_index = circuit_constructor.real_variable_index;
 
-    // For some flavors, we need to ensure the value in the 0th index of each wire is 0 to allow for left-shift by 1. To
-    // do this, we add the wires of the first gate in the execution trace to the "zero index" copy cycle.
-    if constexpr (Flavor::has_zero_row) {
-        for (size_t wire_idx = 0; wire_idx < Flavor::NUM_WIRES; ++wire_idx) {
-            const auto wire_index = static_cast<uint32_t>(wire_idx);
-            const uint32_t gate_index = 0;                          // place zeros at 0th index
-            const uint32_t zero_idx = circuit_constructor.zero_idx; // index of constant zero in variables
-            copy_cycles[zero_idx].emplace_back(cycle_node{ wire_index, gate_index });
-        }
-    }
-
     // Define offsets for placement of public inputs and gates in execution trace
     const size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
     size_t pub_inputs_offset = num_zero_rows;
     size_t gates_offset = num_public_inputs + num_zero_rows;
-
-    // If Goblin, adjust offsets to account for ecc op gates and update copy cycles to include these gates
+    size_t num_ecc_op_gates = 0;
     if constexpr (IsGoblinFlavor<Flavor>) {
-        // Set ecc op gate offset and update offsets for PI and conventional gates
-        const size_t op_gates_offset = num_zero_rows;
-        const size_t num_ecc_op_gates = circuit_constructor.num_ecc_op_gates;
+        num_ecc_op_gates = circuit_constructor.num_ecc_op_gates;
         pub_inputs_offset += num_ecc_op_gates;
         gates_offset += num_ecc_op_gates;
+    }
+
+    // The nodes of the execution trace in order, and the variable held by each of them
+    const size_t num_zero_row_nodes = num_zero_rows * Flavor::NUM_WIRES;
+    const size_t num_ecc_op_nodes = num_ecc_op_gates * Flavor::NUM_WIRES;
+    const size_t pub_inputs_nodes_offset = num_zero_row_nodes + num_ecc_op_nodes;
+    const size_t gates_nodes_offset = pub_inputs_nodes_offset + 2 * num_public_inputs;
+    const size_t num_nodes = gates_nodes_offset + num_gates * num_wires;
+    std::vector<cycle_node> trace_nodes(num_nodes);
+    std::vector<uint32_t> node_variables(num_nodes);
+
+    // For some flavors, we need to ensure the value in the 0th index of each wire is 0 to allow for left-shift by 1. To
+    // do this, we add the wires of the first gate in the execution trace to the "zero index" copy cycle.
+    for (size_t wire_idx = 0; wire_idx < num_zero_row_nodes; ++wire_idx) {
+        const uint32_t gate_index = 0; // place zeros at 0th index
+        trace_nodes[wire_idx] = cycle_node{ static_cast<uint32_t>(wire_idx), gate_index };
+        node_variables[wire_idx] = circuit_constructor.zero_idx; // index of constant zero in variables
+    }
 
+    // If Goblin, add the variables of the ecc op gates, which directly follow the zero row
+    if constexpr (IsGoblinFlavor<Flavor>) {
         const auto& op_wires = circuit_constructor.ecc_op_wires;
-        // Iterate over all variables of the ecc op gates, and add a corresponding node to the cycle for that variable
         for (size_t i = 0; i < num_ecc_op_gates; ++i) {
             for (size_t op_wire_idx = 0; op_wire_idx < Flavor::NUM_WIRES; ++op_wire_idx) {
-                const uint32_t var_index = circuit_constructor.real_variable_index[op_wires[op_wire_idx][i]];
-                const auto wire_index = static_cast<uint32_t>(op_wire_idx);
-                const auto gate_idx = static_cast<uint32_t>(i + op_gates_offset);
-                copy_cycles[var_index].emplace_back(cycle_node{ wire_index, gate_idx });
+                const size_t node_idx = num_zero_row_nodes + i * Flavor::NUM_WIRES + op_wire_idx;
+                trace_nodes[node_idx] =
+                    cycle_node{ static_cast<uint32_t>(op_wire_idx), static_cast<uint32_t>(i + num_zero_rows) };
+                node_variables[node_idx] = real_variable_index[op_wires[op_wire_idx][i]];
             }
         }
     }
@@ -137,26 +163,94 @@ std::vector<CyclicPermutation> compute_wire_copy_cycles(const typename Flavor::C
         const uint32_t public_input_index = real_variable_index[public_inputs[i]];
         const auto gate_index = static_cast<uint32_t>(i + pub_inputs_offset);
         // These two nodes must be in adjacent locations in the cycle for correct handling of public inputs
-        copy_cycles[public_input_index].emplace_back(cycle_node{ 0, gate_index });
-        copy_cycles[public_input_index].emplace_back(cycle_node{ 1, gate_index });
+        const size_t node_idx = pub_inputs_nodes_offset + 2 * i;
+        trace_nodes[node_idx] = cycle_node{ 0, gate_index };
+        trace_nodes[node_idx + 1] = cycle_node{ 1, gate_index };
+        node_variables[node_idx] = public_input_index;
+        node_variables[node_idx + 1] = public_input_index;
     }
 
     // Iterate over all variables of the "real" gates, and add a corresponding node to the cycle for that variable
-    for (size_t i = 0; i < num_gates; ++i) {
-        size_t wire_idx = 0;
-        for (auto& wire : circuit_constructor.wires) {
-            // We are looking at the j-th wire in the i-th row.
-            // The value in this position should be equal to the value of the element at index `var_index`
-            // of the `constructor.variables` vector.
-            // Therefore, we add (i,j) to the cycle at index `var_index` to indicate that w^j_i should have the values
-            // constructor.variables[var_index].
-            const uint32_t var_index = circuit_constructor.real_variable_index[wire[i]];
-            const auto wire_index = static_cast<uint32_t>(wire_idx);
-            const auto gate_idx = static_cast<uint32_t>(i + gates_offset);
-            copy_cycles[var_index].emplace_back(cycle_node{ wire_index, gate_idx });
-            ++wire_idx;
+    const size_t num_threads = barretenberg::thread_utils::calculate_num_threads(num_gates);
+    const size_t gates_per_thread = (num_gates + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * gates_per_thread;
+        const size_t end = std::min(start + gates_per_thread, num_gates);
+        for (size_t i = start; i < end; ++i) {
+            for (size_t wire_idx = 0; wire_idx < num_wires; ++wire_idx) {
+                // We are looking at the j-th wire in the i-th row.
+                // The value in this position should be equal to the value of the element at index `var_index`
+                // of the `constructor.variables` vector.
+                // Therefore, we add (i,j) to the cycle at index `var_index` to indicate that w^j_i should have the
+                // values constructor.variables[var_index].
+                const size_t node_idx = gates_nodes_offset + i * num_wires + wire_idx;
+                trace_nodes[node_idx] =
+                    cycle_node{ static_cast<uint32_t>(wire_idx), static_cast<uint32_t>(i + gates_offset) };
+                node_variables[node_idx] = real_variable_index[circuit_constructor.wires[wire_idx][i]];
+            }
         }
-    }
+    });
+
+    // Bucket the nodes by variable, keeping them in trace order within each bucket. Each thread counts and later
+    // scatters one contiguous chunk of nodes, and within a bucket the nodes of a thread follow those of the threads
+    // before it. The per-thread counts take at most as much memory as the nodes, which bounds the number of threads.
+    const size_t num_scatter_threads =
+        std::clamp(num_nodes / std::max(number_of_cycles, size_t(1)),
+                   size_t(1),
+                   barretenberg::thread_utils::calculate_num_threads(num_nodes));
+    const size_t nodes_per_thread = (num_nodes + num_scatter_threads - 1) / num_scatter_threads;
+    std::vector<std::vector<uint32_t>> next_node(num_scatter_threads);
+    parallel_for(num_scatter_threads, [&](size_t thread_idx) {
+        next_node[thread_idx].resize(number_of_cycles, 0);
+        const size_t start = thread_idx * nodes_per_thread;
+        const size_t end = std::min(start + nodes_per_thread, num_nodes);
+        for (size_t node_idx = start; node_idx < end; ++node_idx) {
+            ++next_node[thread_idx][node_variables[node_idx]];
+        }
+    });
+
+    // Turn the counts into the position of each thread's first node in each bucket. The variables are split into
+    // chunks: the node count of each chunk is summed first, then each chunk is offset by the counts of those before it.
+    CopyCycles copy_cycles;
+    copy_cycles.offsets.resize(number_of_cycles + 1);
+    const size_t num_sum_threads = barretenberg::thread_utils::calculate_num_threads(number_of_cycles);
+    const size_t cycles_per_thread = (number_of_cycles + num_sum_threads - 1) / num_sum_threads;
+    std::vector<uint32_t> chunk_offsets(num_sum_threads + 1, 0);
+    parallel_for(num_sum_threads, [&](size_t chunk_idx) {
+        const size_t start = chunk_idx * cycles_per_thread;
+        const size_t end = std::min(start + cycles_per_thread, number_of_cycles);
+        uint32_t chunk_count = 0;
+        for (size_t var_index = start; var_index < end; ++var_index) {
+            for (const auto& counts : next_node) {
+                chunk_count += counts[var_index];
+            }
+        }
+        chunk_offsets[chunk_idx + 1] = chunk_count;
+    });
+    std::partial_sum(chunk_offsets.begin(), chunk_offsets.end(), chunk_offsets.begin());
+    parallel_for(num_sum_threads, [&](size_t chunk_idx) {
+        const size_t start = chunk_idx * cycles_per_thread;
+        const size_t end = std::min(start + cycles_per_thread, number_of_cycles);
+        uint32_t offset = chunk_offsets[chunk_idx];
+        for (size_t var_index = start; var_index < end; ++var_index) {
+            copy_cycles.offsets[var_index] = offset;
+            for (auto& counts : next_node) {
+                const uint32_t count = counts[var_index];
+                counts[var_index] = offset;
+                offset += count;
+            }
+        }
+    });
+    copy_cycles.offsets[number_of_cycles] = static_cast<uint32_t>(num_nodes);
+
+    copy_cycles.nodes.resize(num_nodes);
+    parallel_for(num_scatter_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * nodes_per_thread;
+        const size_t end = std::min(start + nodes_per_thread, num_nodes);
+        for (size_t node_idx = start; node_idx < end; ++node_idx) {
+            copy_cycles.nodes[next_node[thread_idx][node_variables[node_idx]]++] = trace_nodes[node_idx];
+        }
+    });
     return copy_cycles;
 }
 
@@ -178,73 +272,94 @@ PermutationMapping<Flavor::NUM_WIRES> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor, typename Flavor::ProvingKey* proving_key)
 {
     // Compute wire copy cycles (cycles of permutations)
-    auto wire_copy_cycles = compute_wire_copy_cycles<Flavor>(circuit_constructor);
+    const auto wire_copy_cycles = compute_wire_copy_cycles<Flavor>(circuit_constructor);
 
     PermutationMapping<Flavor::NUM_WIRES> mapping;
 
     // Initialize the table of permutations so that every element points to itself
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/391) zip
+    const size_t circuit_size = proving_key->circuit_size;
     for (size_t i = 0; i < Flavor::NUM_WIRES; ++i) {
-        mapping.sigmas[i].reserve(proving_key->circuit_size);
+        mapping.sigmas[i].resize(circuit_size);
         if constexpr (generalized) {
-            mapping.ids[i].reserve(proving_key->circuit_size);
+            mapping.ids[i].resize(circuit_size);
         }
-
-        for (size_t j = 0; j < proving_key->circuit_size; ++j) {
-            mapping.sigmas[i].emplace_back(permutation_subgroup_element{ .row_index = static_cast<uint32_t>(j),
-                                                                         .column_index = static_cast<uint8_t>(i),
-                                                                         .is_public_input = false,
-                                                                         .is_tag = false });
+    }
+    parallel_for(Flavor::NUM_WIRES, [&](size_t i) {
+        for (size_t j = 0; j < circuit_size; ++j) {
+            const permutation_subgroup_element self{ .row_index = static_cast<uint32_t>(j),
+                                                     .column_index = static_cast<uint8_t>(i),
+                                                     .is_public_input = false,
+                                                     .is_tag = false };
+            mapping.sigmas[i][j] = self;
             if constexpr (generalized) {
-                mapping.ids[i].emplace_back(permutation_subgroup_element{ .row_index = static_cast<uint32_t>(j),
-                                                                          .column_index = static_cast<uint8_t>(i),
-                                                                          .is_public_input = false,
-                                                                          .is_tag = false });
+                mapping.ids[i][j] = self;
             }
         }
-    }
+    });
 
     // Represents the index of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    size_t cycle_index = 0;
-    for (auto& copy_cycle : wire_copy_cycles) {
-        for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
-            // Get the indices of the current node and next node in the cycle
-            cycle_node current_cycle_node = copy_cycle[node_idx];
-            // If current node is the last one in the cycle, then the next one is the first one
-            size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
-            cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
-            const auto current_row = current_cycle_node.gate_index;
-            const auto next_row = next_cycle_node.gate_index;
-
-            const auto current_column = current_cycle_node.wire_index;
-            const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
-            // Point current node to the next node
-            mapping.sigmas[current_column][current_row] = {
-                .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
-            };
-
-            if constexpr (generalized) {
-                bool first_node = (node_idx == 0);
-                bool last_node = (next_cycle_node_index == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column][current_row].is_tag = true;
-                    mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column][current_row].is_tag = true;
+    // The tag permutation tau as a flat table, rather than looking up the std::map once per cycle
+    std::vector<std::optional<uint32_t>> tau;
+    if constexpr (generalized) {
+        if (!circuit_constructor.tau.empty()) {
+            tau.resize(circuit_constructor.tau.rbegin()->first + 1);
+            for (const auto& [tag, tau_tag] : circuit_constructor.tau) {
+                tau[tag] = tau_tag;
+            }
+        }
+        // The last node of every cycle points to tau of the cycle's tag. Check that it exists before the cycles are
+        // handled concurrently, so the error is raised on this thread.
+        for (size_t cycle_index = 0; cycle_index < wire_copy_cycles.size(); ++cycle_index) {
+            const uint32_t tag = real_variable_tags[cycle_index];
+            if (!wire_copy_cycles[cycle_index].empty() && (tag >= tau.size() || !tau[tag].has_value())) {
+                throw_or_abort("Variable tag " + std::to_string(tag) + " has no entry in the tag permutation tau.");
+            }
+        }
+    }
 
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column][current_row].row_index =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+    // Go through each cycle. Every node belongs to exactly one cycle, so the cycles can be handled concurrently.
+    const size_t num_cycles = wire_copy_cycles.size();
+    const size_t num_threads = barretenberg::thread_utils::calculate_num_threads(num_cycles);
+    const size_t cycles_per_thread = (num_cycles + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * cycles_per_thread;
+        const size_t end = std::min(start + cycles_per_thread, num_cycles);
+        for (size_t cycle_index = start; cycle_index < end; ++cycle_index) {
+            const auto copy_cycle = wire_copy_cycles[cycle_index];
+            for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
+                // Get the indices of the current node and next node in the cycle
+                cycle_node current_cycle_node = copy_cycle[node_idx];
+                // If current node is the last one in the cycle, then the next one is the first one
+                size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
+                cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
+                const auto current_row = current_cycle_node.gate_index;
+                const auto next_row = next_cycle_node.gate_index;
+
+                const auto current_column = current_cycle_node.wire_index;
+                const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
+                // Point current node to the next node
+                mapping.sigmas[current_column][current_row] = {
+                    .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
+                };
+
+                if constexpr (generalized) {
+                    bool first_node = (node_idx == 0);
+                    bool last_node = (next_cycle_node_index == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column][current_row].is_tag = true;
+                        mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
+                    }
+                    if (last_node) {
+                        mapping.sigmas[current_column][current_row].is_tag = true;
+                        mapping.sigmas[current_column][current_row].row_index = *tau[real_variable_tags[cycle_index]];
+                    }
                 }
             }
         }
-        cycle_index++;
-    }
+    });
 
     // Add information about public inputs to the computation
     const auto num_public_inputs = static_cast<uint32_t>(circuit_constructor.public_inputs.size());
@@ -294,7 +409,7 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
         if (current_mapping.is_public_input) {
             // We intentionally want to break the cycles of the public input variables.
             // During the witness generation, the left and right wire polynomials at index i contain the i-th public
-            // input. The CyclicPermutation created for these variables always start with (i) -> (n+i), followed by
+            // input. The copy cycles created for these variables always start with (i) -> (n+i), followed by
             // the indices of the variables in the "real" gates. We make i point to -(i+1), so that the only way of
             // repairing the cycle is add the mapping
             //  -(i+1) -> (n+i)
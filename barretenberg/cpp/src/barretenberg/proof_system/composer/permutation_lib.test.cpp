@@ -1,4 +1,5 @@
 #include "barretenberg/proof_system/composer/permutation_lib.hpp"
+#include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/flavor/ultra.hpp"
 #include "barretenberg/proof_system/composer/composer_lib.hpp"
 #include "barretenberg/proof_system/types/circuit_type.hpp"
@@ -8,6 +9,171 @@
 
 namespace proof_system::test_composer_lib {
 
+namespace {
+
+/**
+ * @brief The permutation mapping as computed before copy cycles were stored in flat arrays, with one std::vector of
+ * nodes per variable and a std::map lookup of tau per cycle. Kept as a reference for compute_permutation_mapping.
+ */
+template <typename Flavor, bool generalized>
+PermutationMapping<Flavor::NUM_WIRES> reference_permutation_mapping(
+    const typename Flavor::CircuitBuilder& circuit_constructor, const size_t circuit_size)
+{
+    const size_t num_public_inputs = circuit_constructor.public_inputs.size();
+    std::vector<std::vector<cycle_node>> copy_cycles(circuit_constructor.variables.size());
+    const auto& real_variable_index = circuit_constructor.real_variable_index;
+
+    if constexpr (Flavor::has_zero_row) {
+        for (uint32_t wire_idx = 0; wire_idx < Flavor::NUM_WIRES; ++wire_idx) {
+            copy_cycles[circuit_constructor.zero_idx].emplace_back(cycle_node{ wire_idx, 0 });
+        }
+    }
+    const size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
+    size_t pub_inputs_offset = num_zero_rows;
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        pub_inputs_offset += circuit_constructor.num_ecc_op_gates;
+        for (size_t i = 0; i < circuit_constructor.num_ecc_op_gates; ++i) {
+            for (uint32_t op_wire_idx = 0; op_wire_idx < Flavor::NUM_WIRES; ++op_wire_idx) {
+                const uint32_t var_index = real_variable_index[circuit_constructor.ecc_op_wires[op_wire_idx][i]];
+                const auto gate_idx = static_cast<uint32_t>(i + num_zero_rows);
+                copy_cycles[var_index].emplace_back(cycle_node{ op_wire_idx, gate_idx });
+            }
+        }
+    }
+    const size_t gates_offset = pub_inputs_offset + num_public_inputs;
+    for (size_t i = 0; i < num_public_inputs; ++i) {
+        const uint32_t var_index = real_variable_index[circuit_constructor.public_inputs[i]];
+        copy_cycles[var_index].emplace_back(cycle_node{ 0, static_cast<uint32_t>(i + pub_inputs_offset) });
+        copy_cycles[var_index].emplace_back(cycle_node{ 1, static_cast<uint32_t>(i + pub_inputs_offset) });
+    }
+    for (size_t i = 0; i < circuit_constructor.num_gates; ++i) {
+        for (uint32_t wire_idx = 0; wire_idx < circuit_constructor.wires.size(); ++wire_idx) {
+            const uint32_t var_index = real_variable_index[circuit_constructor.wires[wire_idx][i]];
+            copy_cycles[var_index].emplace_back(cycle_node{ wire_idx, static_cast<uint32_t>(i + gates_offset) });
+        }
+    }
+
+    PermutationMapping<Flavor::NUM_WIRES> mapping;
+    for (size_t i = 0; i < Flavor::NUM_WIRES; ++i) {
+        for (size_t j = 0; j < circuit_size; ++j) {
+            const permutation_subgroup_element self{ .row_index = static_cast<uint32_t>(j),
+                                                     .column_index = static_cast<uint8_t>(i),
+                                                     .is_public_input = false,
+                                                     .is_tag = false };
+            mapping.sigmas[i].emplace_back(self);
+            if constexpr (generalized) {
+                mapping.ids[i].emplace_back(self);
+            }
+        }
+    }
+    for (size_t cycle_index = 0; cycle_index < copy_cycles.size(); ++cycle_index) {
+        const auto& copy_cycle = copy_cycles[cycle_index];
+        for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
+            const cycle_node current = copy_cycle[node_idx];
+            const size_t next_node_idx = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
+            const cycle_node next = copy_cycle[next_node_idx];
+            auto& sigma = mapping.sigmas[current.wire_index][current.gate_index];
+            sigma = { .row_index = next.gate_index,
+                      .column_index = static_cast<uint8_t>(next.wire_index),
+                      .is_public_input = false,
+                      .is_tag = false };
+            if constexpr (generalized) {
+                const uint32_t tag = circuit_constructor.real_variable_tags[cycle_index];
+                if (node_idx == 0) {
+                    mapping.ids[current.wire_index][current.gate_index].is_tag = true;
+                    mapping.ids[current.wire_index][current.gate_index].row_index = tag;
+                }
+                if (next_node_idx == 0) {
+                    sigma.is_tag = true;
+                    sigma.row_index = circuit_constructor.tau.at(tag);
+                }
+            }
+        }
+    }
+    for (size_t i = 0; i < num_public_inputs; ++i) {
+        const size_t idx = i + pub_inputs_offset;
+        mapping.sigmas[0][idx] = { .row_index = static_cast<uint32_t>(idx),
+                                   .column_index = 0,
+                                   .is_public_input = true,
+                                   .is_tag = mapping.sigmas[0][idx].is_tag };
+    }
+    return mapping;
+}
+
+void expect_mappings_equal(const auto& expected, const auto& actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i].size(), actual[i].size());
+        for (size_t j = 0; j < expected[i].size(); ++j) {
+            EXPECT_EQ(expected[i][j].row_index, actual[i][j].row_index) << "column " << i << ", row " << j;
+            EXPECT_EQ(expected[i][j].column_index, actual[i][j].column_index) << "column " << i << ", row " << j;
+            EXPECT_EQ(expected[i][j].is_public_input, actual[i][j].is_public_input) << "column " << i << ", row " << j;
+            EXPECT_EQ(expected[i][j].is_tag, actual[i][j].is_tag) << "column " << i << ", row " << j;
+        }
+    }
+}
+
+/**
+ * @brief Check compute_permutation_mapping against the reference on a circuit with copy constraints, public inputs,
+ * range constraints (which use tags) and, for Goblin flavors, ecc op gates
+ */
+template <typename Flavor> void check_permutation_mapping_against_reference()
+{
+    using FF = typename Flavor::FF;
+    typename Flavor::CircuitBuilder builder;
+
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        for (size_t i = 0; i < 3; ++i) {
+            auto point = curve::BN254::AffineElement::one() * FF::random_element();
+            builder.queue_ecc_mul_accum(point, FF::random_element());
+        }
+        builder.queue_ecc_eq();
+    }
+    std::vector<uint32_t> shared_indices;
+    for (size_t i = 0; i < 16; ++i) {
+        const FF a = FF::random_element();
+        const FF b = FF::random_element();
+        const uint32_t a_idx = (i % 3 == 0) ? builder.add_public_variable(a) : builder.add_variable(a);
+        const uint32_t b_idx = builder.add_variable(b);
+        const uint32_t c_idx = builder.add_variable(a + b);
+        builder.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+        shared_indices.emplace_back(c_idx);
+        const uint32_t small_idx = builder.add_variable(FF(i));
+        builder.create_new_range_constraint(small_idx, 15);
+    }
+    // Merge some of the cycles, so that real_variable_index is not the identity
+    for (size_t i = 1; i < shared_indices.size(); i += 4) {
+        const uint32_t copy_idx = builder.add_variable(builder.get_variable(shared_indices[i]));
+        builder.create_add_gate({ copy_idx, builder.zero_idx, builder.zero_idx, 1, 0, 0, 0 });
+        builder.assert_equal(copy_idx, shared_indices[i]);
+    }
+    builder.finalize_circuit();
+
+    size_t num_rows = (Flavor::has_zero_row ? 1 : 0) + builder.public_inputs.size() + builder.num_gates;
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        num_rows += builder.num_ecc_op_gates;
+    }
+    const size_t circuit_size = builder.get_circuit_subgroup_size(num_rows);
+    auto proving_key = std::make_shared<typename Flavor::ProvingKey>(circuit_size, builder.public_inputs.size());
+
+    auto expected = reference_permutation_mapping<Flavor, /*generalized=*/true>(builder, circuit_size);
+    auto actual = compute_permutation_mapping<Flavor, /*generalized=*/true>(builder, proving_key.get());
+    expect_mappings_equal(expected.sigmas, actual.sigmas);
+    expect_mappings_equal(expected.ids, actual.ids);
+
+    auto expected_sigmas = reference_permutation_mapping<Flavor, /*generalized=*/false>(builder, circuit_size);
+    auto actual_sigmas = compute_permutation_mapping<Flavor, /*generalized=*/false>(builder, proving_key.get());
+    expect_mappings_equal(expected_sigmas.sigmas, actual_sigmas.sigmas);
+}
+
+// The Plonk flavors lay out the execution trace without a zero row
+struct UltraWithoutZeroRow : public honk::flavor::Ultra {
+    static constexpr bool has_zero_row = false;
+};
+
+} // namespace
+
 class PermutationHelperTests : public ::testing::Test {
   protected:
     using Flavor = honk::flavor::Ultra;
@@ -67,8 +233,32 @@ class PermutationHelperTests : public ::testing::Test {
 
 TEST_F(PermutationHelperTests, ComputeWireCopyCycles)
 {
-    // TODO(#425) Flesh out these tests
-    compute_wire_copy_cycles<Flavor>(circuit_constructor);
+    auto copy_cycles = compute_wire_copy_cycles<Flavor>(circuit_constructor);
+    EXPECT_EQ(copy_cycles.size(), circuit_constructor.variables.size());
+
+    // Every position in the trace belongs to exactly one cycle, and the nodes of a cycle are in trace order
+    const size_t num_public_inputs = circuit_constructor.public_inputs.size();
+    const size_t gates_offset = num_public_inputs + 1; // zero row + public inputs
+    const size_t num_nodes =
+        Flavor::NUM_WIRES * (1 + circuit_constructor.num_gates) + 2 * num_public_inputs; // zero row
+    size_t total_nodes = 0;
+    for (size_t cycle_index = 0; cycle_index < copy_cycles.size(); ++cycle_index) {
+        const auto cycle = copy_cycles[cycle_index];
+        total_nodes += cycle.size();
+        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+            const auto& node = cycle[node_idx];
+            if (node_idx > 0) {
+                const auto& prev = cycle[node_idx - 1];
+                EXPECT_TRUE(prev.gate_index < node.gate_index ||
+                            (prev.gate_index == node.gate_index && prev.wire_index < node.wire_index));
+            }
+            if (node.gate_index >= gates_offset) {
+                const uint32_t var_index = circuit_constructor.wires[node.wire_index][node.gate_index - gates_offset];
+                EXPECT_EQ(circuit_constructor.real_variable_index[var_index], cycle_index);
+            }
+        }
+    }
+    EXPECT_EQ(total_nodes, num_nodes);
 }
 
 TEST_F(PermutationHelperTests, ComputePermutationMapping)
@@ -77,6 +267,22 @@ TEST_F(PermutationHelperTests, ComputePermutationMapping)
     compute_permutation_mapping<Flavor, /*generalized=*/false>(circuit_constructor, proving_key.get());
 }
 
+TEST_F(PermutationHelperTests, ComputePermutationMappingMatchesReference)
+{
+    check_permutation_mapping_against_reference<honk::flavor::Ultra>();
+    check_permutation_mapping_against_reference<honk::flavor::GoblinUltra>();
+    check_permutation_mapping_against_reference<UltraWithoutZeroRow>();
+}
+
+TEST_F(PermutationHelperTests, ComputePermutationMappingRejectsTagWithoutTau)
+{
+    const uint32_t tagged_idx = circuit_constructor.add_variable(16);
+    circuit_constructor.create_add_gate({ tagged_idx, tagged_idx, tagged_idx, 0, 0, 0, 0 });
+    circuit_constructor.assign_tag(tagged_idx, circuit_constructor.get_new_tag());
+    EXPECT_THROW((compute_permutation_mapping<Flavor, /*generalized=*/true>(circuit_constructor, proving_key.get())),
+                 std::runtime_error);
+}
+
 TEST_F(PermutationHelperTests, ComputeHonkStyleSigmaLagrangePolynomialsFromMapping)
 {
     // TODO(#425) Flesh out these tests
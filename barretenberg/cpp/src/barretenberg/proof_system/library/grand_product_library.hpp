@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_lanes.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
@@ -100,17 +101,14 @@ void compute_grand_product(const size_t circuit_size,
     parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
         const size_t end = (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end - 1; ++i) {
-            numerator[i + 1] *= numerator[i];
-            denominator[i + 1] *= denominator[i];
-        }
+        barretenberg::field_lanes::prefix_product(&numerator[start], block_size);
+        barretenberg::field_lanes::prefix_product(&denominator[start], block_size);
         partial_numerators[thread_idx] = numerator[end - 1];
         partial_denominators[thread_idx] = denominator[end - 1];
     });
 
     parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
         if (thread_idx > 0) {
             FF numerator_scaling = 1;
             FF denominator_scaling = 1;
@@ -119,10 +117,10 @@ void compute_grand_product(const size_t circuit_size,
                 numerator_scaling *= partial_numerators[j];
                 denominator_scaling *= partial_denominators[j];
             }
-            for (size_t i = start; i < end; ++i) {
-                numerator[i] *= numerator_scaling;
-                denominator[i] *= denominator_scaling;
-            }
+            barretenberg::field_lanes::mul_by_scalar(
+                &numerator[start], numerator_scaling, &numerator[start], block_size);
+            barretenberg::field_lanes::mul_by_scalar(
+                &denominator[start], denominator_scaling, &denominator[start], block_size);
         }
 
         // Final step: invert denominator
@@ -135,9 +133,8 @@ void compute_grand_product(const size_t circuit_size,
     parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
         const size_t end = (thread_idx == num_threads - 1) ? circuit_size - 1 : (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end; ++i) {
-            grand_product_polynomial[i + 1] = numerator[i] * denominator[i];
-        }
+        barretenberg::field_lanes::mul(
+            &numerator[start], &denominator[start], &grand_product_polynomial[start + 1], end - start);
     });
 }
 
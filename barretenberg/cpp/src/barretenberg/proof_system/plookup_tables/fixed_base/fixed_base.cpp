@@ -2,10 +2,21 @@
 #include "./fixed_base.hpp"
 
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/crypto/blake3s/blake3s.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/numeric/bitop/rotate.hpp"
 #include "barretenberg/numeric/bitop/sparse_form.hpp"
+
+#include <algorithm>
+
+#ifdef FIXED_BASE_TABLES_BLOB
+// Defines FIXED_BASE_TABLES_DIGEST, FIXED_BASE_TABLE_POINTS and FIXED_BASE_OFFSET_GENERATORS (see
+// fixed_base_tables_gen)
+#include "fixed_base_tables.inc"
+#endif
+
 namespace plookup::fixed_base {
 
 /**
@@ -138,16 +149,16 @@ std::optional<std::array<MultiTableId, 2>> table::get_lookup_table_ids_for_point
 std::optional<grumpkin::g1::affine_element> table::get_generator_offset_for_table_id(const MultiTableId table_id)
 {
     if (table_id == FIXED_BASE_LEFT_LO) {
-        return fixed_base_table_offset_generators[0];
+        return fixed_base_table_offset_generators()[0];
     }
     if (table_id == FIXED_BASE_LEFT_HI) {
-        return fixed_base_table_offset_generators[1];
+        return fixed_base_table_offset_generators()[1];
     }
     if (table_id == FIXED_BASE_RIGHT_LO) {
-        return fixed_base_table_offset_generators[2];
+        return fixed_base_table_offset_generators()[2];
     }
     if (table_id == FIXED_BASE_RIGHT_HI) {
-        return fixed_base_table_offset_generators[3];
+        return fixed_base_table_offset_generators()[3];
     }
     return std::nullopt;
 }
@@ -200,7 +211,7 @@ BasicTable table::generate_basic_fixed_base_table(BasicTableId id, size_t basic_
     table.size = table_size;
     table.use_twin_keys = false;
 
-    const auto& basic_table = fixed_base_tables[multitable_index][table_index];
+    const auto& basic_table = fixed_base_tables()[multitable_index][table_index];
 
     for (size_t i = 0; i < table.size; ++i) {
         table.column_1.emplace_back(i);
@@ -272,19 +283,106 @@ template MultiTable table::get_fixed_base_table<1, table::BITS_PER_HI_SCALAR>(Mu
 template MultiTable table::get_fixed_base_table<2, table::BITS_PER_LO_SCALAR>(MultiTableId);
 template MultiTable table::get_fixed_base_table<3, table::BITS_PER_HI_SCALAR>(MultiTableId);
 
-const table::all_multi_tables table::fixed_base_tables = {
-    table::generate_tables<BITS_PER_LO_SCALAR>(lhs_base_point_lo),
-    table::generate_tables<BITS_PER_HI_SCALAR>(lhs_base_point_hi),
-    table::generate_tables<BITS_PER_LO_SCALAR>(rhs_base_point_lo),
-    table::generate_tables<BITS_PER_HI_SCALAR>(rhs_base_point_hi),
-};
+std::vector<uint8_t> table::compute_tables_digest(
+    const all_multi_table_views& tables,
+    const std::array<affine_element, NUM_FIXED_BASE_MULTI_TABLES>& offset_generators)
+{
+    std::vector<uint8_t> input;
+    for (const auto& base_point : { lhs_base_point_lo, lhs_base_point_hi, rhs_base_point_lo, rhs_base_point_hi }) {
+        serialize::write(input, base_point);
+    }
+    for (const size_t param : { BITS_PER_TABLE, BITS_PER_LO_SCALAR, BITS_PER_HI_SCALAR, MAX_TABLE_SIZE }) {
+        serialize::write(input, static_cast<uint64_t>(param));
+    }
+    // The tables are embedded in Montgomery form, so they are only valid for the same representation of one
+    for (const uint64_t limb : grumpkin::fq::one().data) {
+        serialize::write(input, limb);
+    }
+    // The points themselves, limb by limb as they are embedded
+    const auto write_point = [&](const affine_element& point) {
+        for (const auto& coordinate : { point.x, point.y }) {
+            for (const uint64_t limb : coordinate.data) {
+                serialize::write(input, limb);
+            }
+        }
+    };
+    for (const auto& multi_table : tables) {
+        for (const auto& lookup_table : multi_table) {
+            serialize::write(input, static_cast<uint64_t>(lookup_table.size()));
+            std::ranges::for_each(lookup_table, write_point);
+        }
+    }
+    std::ranges::for_each(offset_generators, write_point);
+    return blake3::blake3s(input);
+}
 
-const std::array<table::affine_element, table::NUM_FIXED_BASE_MULTI_TABLES>
-    table::fixed_base_table_offset_generators = {
-        table::generate_generator_offset<BITS_PER_LO_SCALAR>(lhs_base_point_lo),
-        table::generate_generator_offset<BITS_PER_HI_SCALAR>(lhs_base_point_hi),
-        table::generate_generator_offset<BITS_PER_LO_SCALAR>(rhs_base_point_lo),
-        table::generate_generator_offset<BITS_PER_HI_SCALAR>(rhs_base_point_hi),
+/**
+ * @brief The software lookup tables for both base points, built the first time they are requested
+ *
+ * @details When built with FIXED_BASE_TABLES_BLOB, the views point straight into the points generated at build time
+ * by fixed_base_tables_gen, after checking the embedded digest against the points and the current base points and
+ * parameters.
+ * Otherwise (e.g. in wasm builds, which cannot run the generator on the build host) the tables are computed here,
+ * serially: the first request may come from a parallel_for worker while other workers wait on this initialiser.
+ * @return const table::all_multi_table_views&
+ */
+const table::all_multi_table_views& table::fixed_base_tables()
+{
+    // Function-local static initialisation happens exactly once, even if several threads get here together
+    static const all_multi_table_views tables = [] {
+#ifdef FIXED_BASE_TABLES_BLOB
+        static_assert(std::size(FIXED_BASE_TABLE_POINTS) == NUM_FIXED_BASE_BASIC_TABLES * MAX_TABLE_SIZE);
+        std::span<const affine_element> points(FIXED_BASE_TABLE_POINTS);
+#else
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        static const all_multi_tables computed_tables{
+            generate_tables<BITS_PER_LO_SCALAR>(lhs_base_point_lo),
+            generate_tables<BITS_PER_HI_SCALAR>(lhs_base_point_hi),
+            generate_tables<BITS_PER_LO_SCALAR>(rhs_base_point_lo),
+            generate_tables<BITS_PER_HI_SCALAR>(rhs_base_point_hi),
+        };
+#endif
+        all_multi_table_views result;
+        for (size_t i = 0; i < NUM_FIXED_BASE_MULTI_TABLES; ++i) {
+            const size_t num_tables = (i % 2 == 0) ? NUM_TABLES_PER_LO_MULTITABLE : NUM_TABLES_PER_HI_MULTITABLE;
+            result[i].reserve(num_tables);
+            for (size_t j = 0; j < num_tables; ++j) {
+#ifdef FIXED_BASE_TABLES_BLOB
+                // The points are listed by multitable, then table, then index
+                result[i].emplace_back(points.first(MAX_TABLE_SIZE));
+                points = points.subspan(MAX_TABLE_SIZE);
+#else
+                result[i].emplace_back(computed_tables[i][j]);
+#endif
+            }
+        }
+#ifdef FIXED_BASE_TABLES_BLOB
+        if (compute_tables_digest(result, FIXED_BASE_OFFSET_GENERATORS) !=
+            std::vector<uint8_t>(std::begin(FIXED_BASE_TABLES_DIGEST), std::end(FIXED_BASE_TABLES_DIGEST))) {
+            throw_or_abort("The embedded fixed-base tables do not match their digest, or were generated from other "
+                           "base points or parameters. Regenerate them with fixed_base_tables_gen.");
+        }
+#endif
+        return result;
+    }();
+    return tables;
+}
+
+const std::array<table::affine_element, table::NUM_FIXED_BASE_MULTI_TABLES>& table::fixed_base_table_offset_generators()
+{
+#ifdef FIXED_BASE_TABLES_BLOB
+    // Checks the embedded points before they are first used
+    static_cast<void>(fixed_base_tables());
+    return FIXED_BASE_OFFSET_GENERATORS;
+#else
+    static const std::array<affine_element, NUM_FIXED_BASE_MULTI_TABLES> offset_generators = {
+        generate_generator_offset<BITS_PER_LO_SCALAR>(lhs_base_point_lo),
+        generate_generator_offset<BITS_PER_HI_SCALAR>(lhs_base_point_hi),
+        generate_generator_offset<BITS_PER_LO_SCALAR>(rhs_base_point_lo),
+        generate_generator_offset<BITS_PER_HI_SCALAR>(rhs_base_point_hi),
     };
+    return offset_generators;
+#endif
+}
 
 } // namespace plookup::fixed_base
\ No newline at end of file
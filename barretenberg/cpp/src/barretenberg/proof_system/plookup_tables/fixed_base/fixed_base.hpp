@@ -5,6 +5,7 @@
 #include "barretenberg/crypto/generators/generator_data.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <span>
 
 namespace plookup::fixed_base {
 
@@ -19,6 +20,9 @@ class table : public FixedBaseParams {
     using single_lookup_table = std::vector<affine_element>;
     using fixed_base_scalar_mul_tables = std::vector<single_lookup_table>;
     using all_multi_tables = std::array<fixed_base_scalar_mul_tables, NUM_FIXED_BASE_MULTI_TABLES>;
+    // Views of the tables, which live either in the tables embedded at build time or in ones computed on first use
+    using single_lookup_table_view = std::span<const affine_element>;
+    using all_multi_table_views = std::array<std::vector<single_lookup_table_view>, NUM_FIXED_BASE_MULTI_TABLES>;
 
     static constexpr affine_element LHS_GENERATOR_POINT =
         crypto::generator_data<curve::Grumpkin>::precomputed_generators[0];
@@ -45,8 +49,21 @@ class table : public FixedBaseParams {
 
     // fixed_base_tables = lookup tables of precomputed base points required for our lookup arguments.
     // N.B. these "tables" are not plookup tables, just regular ol' software lookup tables.
-    // Used to build the proper plookup table and in the `BasicTable::get_values_from_key` method
-    static const all_multi_tables fixed_base_tables;
+    // Used to build the proper plookup table and in the `BasicTable::get_values_from_key` method.
+    // Built on first use rather than in a static initialiser, so that programs which never perform a fixed-base lookup
+    // do not pay for the EC arithmetic at startup.
+    static const all_multi_table_views& fixed_base_tables();
+
+    /**
+     * @brief A digest of the given tables and offset generators, and of everything they are generated from: the base
+     * points, the table parameters and the Montgomery representation of the field.
+     * @details fixed_base_tables_gen embeds the digest of the tables it writes, and the embedded tables are only used
+     * while their digest still matches, so tables that were generated from other points or parameters, or have since
+     * been altered, can never be used by mistake.
+     */
+    static std::vector<uint8_t> compute_tables_digest(
+        const all_multi_table_views& tables,
+        const std::array<affine_element, NUM_FIXED_BASE_MULTI_TABLES>& offset_generators);
 
     /**
      * @brief offset generators!
@@ -63,7 +80,7 @@ class table : public FixedBaseParams {
      * The final scalar multiplication output will have a precisely-known contribution from the offset generators,
      * which can then be subtracted off with a single point subtraction.
      **/
-    static const std::array<affine_element, table::NUM_FIXED_BASE_MULTI_TABLES> fixed_base_table_offset_generators;
+    static const std::array<affine_element, NUM_FIXED_BASE_MULTI_TABLES>& fixed_base_table_offset_generators();
 
     static bool lookup_table_exists_for_point(const affine_element& input);
     static std::optional<std::array<MultiTableId, 2>> get_lookup_table_ids_for_point(const affine_element& input);
@@ -78,7 +95,7 @@ class table : public FixedBaseParams {
     {
         static_assert(multitable_index < NUM_FIXED_BASE_MULTI_TABLES);
         static_assert(table_index < get_num_bits_of_multi_table(multitable_index));
-        const auto& basic_table = fixed_base_tables[multitable_index][table_index];
+        const auto& basic_table = fixed_base_tables()[multitable_index][table_index];
         const auto index = static_cast<size_t>(key[0]);
         return { basic_table[index].x, basic_table[index].y };
     }
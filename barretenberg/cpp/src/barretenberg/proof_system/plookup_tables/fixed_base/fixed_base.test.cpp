@@ -0,0 +1,60 @@
+#include "fixed_base.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+
+namespace plookup::fixed_base::test {
+
+/**
+ * @brief fixed_base_tables() is either read from the tables embedded at build time or computed on first use. Either way
+ * it must equal the tables that used to be computed by static initialisers.
+ */
+TEST(FixedBaseTables, MatchGeneratedTables)
+{
+    const table::all_multi_tables expected_tables{
+        table::generate_tables<table::BITS_PER_LO_SCALAR>(table::lhs_base_point_lo),
+        table::generate_tables<table::BITS_PER_HI_SCALAR>(table::lhs_base_point_hi),
+        table::generate_tables<table::BITS_PER_LO_SCALAR>(table::rhs_base_point_lo),
+        table::generate_tables<table::BITS_PER_HI_SCALAR>(table::rhs_base_point_hi),
+    };
+    const std::array<table::affine_element, table::NUM_FIXED_BASE_MULTI_TABLES> expected_offset_generators{
+        table::generate_generator_offset<table::BITS_PER_LO_SCALAR>(table::lhs_base_point_lo),
+        table::generate_generator_offset<table::BITS_PER_HI_SCALAR>(table::lhs_base_point_hi),
+        table::generate_generator_offset<table::BITS_PER_LO_SCALAR>(table::rhs_base_point_lo),
+        table::generate_generator_offset<table::BITS_PER_HI_SCALAR>(table::rhs_base_point_hi),
+    };
+
+    const auto& tables = table::fixed_base_tables();
+    const auto& offset_generators = table::fixed_base_table_offset_generators();
+    for (size_t i = 0; i < table::NUM_FIXED_BASE_MULTI_TABLES; ++i) {
+        ASSERT_EQ(tables[i].size(), expected_tables[i].size());
+        for (size_t j = 0; j < tables[i].size(); ++j) {
+            EXPECT_TRUE(std::ranges::equal(tables[i][j], expected_tables[i][j]))
+                << "multitable " << i << ", table " << j;
+        }
+        EXPECT_EQ(offset_generators[i], expected_offset_generators[i]);
+    }
+}
+
+/**
+ * @brief The digest embedded with the tables covers the points themselves, so altering any of them changes it
+ */
+TEST(FixedBaseTables, DigestCoversPoints)
+{
+    const auto& tables = table::fixed_base_tables();
+    const auto& offset_generators = table::fixed_base_table_offset_generators();
+    const auto digest = table::compute_tables_digest(tables, offset_generators);
+    EXPECT_EQ(table::compute_tables_digest(tables, offset_generators), digest);
+
+    // Negate the last point of the last table
+    std::vector<table::affine_element> altered_table(tables.back().back().begin(), tables.back().back().end());
+    altered_table.back() = -altered_table.back();
+    auto altered_tables = tables;
+    altered_tables.back().back() = altered_table;
+    EXPECT_NE(table::compute_tables_digest(altered_tables, offset_generators), digest);
+
+    auto altered_offset_generators = offset_generators;
+    altered_offset_generators[0] = -altered_offset_generators[0];
+    EXPECT_NE(table::compute_tables_digest(tables, altered_offset_generators), digest);
+}
+
+} // namespace plookup::fixed_base::test
@@ -4,7 +4,7 @@ namespace plookup {
 namespace ecc_generator_tables {
 
 /**
- * Init 8-bit generator lookup tables
+ * Init 8-bit generator lookup tables, once per process
  * The 8-bit wNAF is structured so that entries are in the range [0, ..., 255]
  *
  * The actual scalar value = (wNAF * 2) - 255
@@ -13,9 +13,12 @@ namespace ecc_generator_tables {
  **/
 template <typename G1> void ecc_generator_table<G1>::init_generator_tables()
 {
-    if (init) {
-        return;
-    }
+    // Circuits built on several threads can ask for the tables at once: one thread fills them while the others wait
+    std::call_once(init_flag, compute_generator_tables);
+}
+
+template <typename G1> void ecc_generator_table<G1>::compute_generator_tables()
+{
     element base_point = G1::one;
 
     auto d2 = base_point.dbl();
@@ -73,7 +76,6 @@ template <typename G1> void ecc_generator_table<G1>::init_generator_tables()
         ecc_generator_table<G1>::generator_endo_xyprime_table[i] = std::make_pair<barretenberg::fr, barretenberg::fr>(
             barretenberg::fr(uint256_t(point_table[i].x * beta)), barretenberg::fr(uint256_t(point_table[i].y)));
     }
-    init = true;
 }
 
 // map 0 to 255 into 0 to 510 in steps of two
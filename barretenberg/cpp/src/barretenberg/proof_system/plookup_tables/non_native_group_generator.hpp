@@ -5,6 +5,7 @@
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
 #include <array>
+#include <mutex>
 
 namespace plookup {
 namespace ecc_generator_tables {
@@ -24,7 +25,7 @@ template <typename G1> class ecc_generator_table {
     inline static std::array<std::pair<barretenberg::fr, barretenberg::fr>, 256> generator_yhi_table;
     inline static std::array<std::pair<barretenberg::fr, barretenberg::fr>, 256> generator_xyprime_table;
     inline static std::array<std::pair<barretenberg::fr, barretenberg::fr>, 256> generator_endo_xyprime_table;
-    inline static bool init = false;
+    inline static std::once_flag init_flag;
 
     static void init_generator_tables();
 
@@ -54,6 +55,9 @@ template <typename G1> class ecc_generator_table {
     static MultiTable get_yhi_table(const MultiTableId id, const BasicTableId basic_id);
     static MultiTable get_xyprime_table(const MultiTableId id, const BasicTableId basic_id);
     static MultiTable get_xyprime_endo_table(const MultiTableId id, const BasicTableId basic_id);
+
+  private:
+    static void compute_generator_tables();
 };
 
 extern template class ecc_generator_table<barretenberg::g1>;
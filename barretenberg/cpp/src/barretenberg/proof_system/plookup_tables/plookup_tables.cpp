@@ -1,5 +1,9 @@
 #include "plookup_tables.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include <memory>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
 
 namespace plookup {
 
@@ -9,8 +13,6 @@ namespace {
 // TODO(@zac-williamson) convert these into static const members of a struct
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
-// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool inited = false;
 
 void init_multi_tables()
 {
@@ -104,13 +106,44 @@ void init_multi_tables()
 
 const MultiTable& create_table(const MultiTableId id)
 {
-    if (!inited) {
+    // Function-local static initialisation happens exactly once, even if several threads get here together
+    static const bool inited = [] {
         init_multi_tables();
-        inited = true;
-    }
+        return true;
+    }();
+    static_cast<void>(inited);
     return MULTI_TABLES[id];
 }
 
+/**
+ * @brief Get the process-wide copy of a basic table, generating it on first use.
+ *
+ * @details Circuit builders used to regenerate every table they used (e.g. the fixed base and keccak tables) for each
+ * circuit. The generated columns do not depend on the circuit, so they are built once per process and shared, and
+ * builders keep only their own lookup gates (see CircuitBasicTable). Tables are never freed or modified once built, so
+ * the returned reference is valid for the lifetime of the process.
+ */
+const BasicTable& get_basic_table(const BasicTableId id)
+{
+    ASSERT(static_cast<size_t>(id) < static_cast<size_t>(BasicTableId::NUM_BASIC_TABLES));
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::array<std::unique_ptr<const BasicTable>, BasicTableId::NUM_BASIC_TABLES> basic_tables;
+    auto& table = basic_tables[static_cast<size_t>(id)];
+#ifndef NO_MULTITHREADING
+    // One flag per table, so that a thread generating one table (which can take a while) does not hold up threads
+    // that want another
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::array<std::once_flag, BasicTableId::NUM_BASIC_TABLES> generated;
+    std::call_once(generated[static_cast<size_t>(id)],
+                   [&] { table = std::make_unique<const BasicTable>(create_basic_table(id, 0)); });
+#else
+    if (!table) {
+        table = std::make_unique<const BasicTable>(create_basic_table(id, 0));
+    }
+#endif
+    return *table;
+}
+
 ReadData<barretenberg::fr> get_lookup_accumulators(const MultiTableId id,
                                                    const fr& key_a,
                                                    const fr& key_b,
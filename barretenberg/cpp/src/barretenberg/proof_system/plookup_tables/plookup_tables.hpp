@@ -20,6 +20,8 @@ namespace plookup {
 
 const MultiTable& create_table(MultiTableId id);
 
+const BasicTable& get_basic_table(BasicTableId id);
+
 ReadData<barretenberg::fr> get_lookup_accumulators(MultiTableId id,
                                                    const barretenberg::fr& key_a,
                                                    const barretenberg::fr& key_b = 0,
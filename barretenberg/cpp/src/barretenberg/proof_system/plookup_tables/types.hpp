@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <span>
 #include <vector>
 
 #include "./fixed_base/fixed_base_params.hpp"
@@ -73,6 +74,7 @@ enum BasicTableId {
     KECCAK_RHO_7,
     KECCAK_RHO_8,
     KECCAK_RHO_9,
+    NUM_BASIC_TABLES,
 };
 
 enum MultiTableId {
@@ -298,6 +300,38 @@ struct BasicTable {
     std::array<barretenberg::fr, 2> (*get_values_from_key)(const std::array<uint64_t, 2>);
 };
 
+/**
+ * @brief A circuit's use of a BasicTable.
+ *
+ * @details The columns of a basic table are the same in every circuit, so they are generated once per process (see
+ * plookup::get_basic_table) and referenced here. Only the position of the table in the circuit and the lookup gates
+ * that read from it are owned by the circuit.
+ */
+struct CircuitBasicTable {
+    CircuitBasicTable(const BasicTable& table, const size_t index)
+        : id(table.id)
+        , table_index(index)
+        , size(table.size)
+        , use_twin_keys(table.use_twin_keys)
+        , column_1(table.column_1)
+        , column_2(table.column_2)
+        , column_3(table.column_3)
+        , get_values_from_key(table.get_values_from_key)
+    {}
+
+    BasicTableId id;
+    size_t table_index;
+    size_t size;
+    bool use_twin_keys;
+
+    std::span<const barretenberg::fr> column_1;
+    std::span<const barretenberg::fr> column_2;
+    std::span<const barretenberg::fr> column_3;
+    std::vector<BasicTable::KeyEntry> lookup_gates;
+
+    std::array<barretenberg::fr, 2> (*get_values_from_key)(const std::array<uint64_t, 2>);
+};
+
 enum ColumnIdx { C1, C2, C3 };
 
 /**
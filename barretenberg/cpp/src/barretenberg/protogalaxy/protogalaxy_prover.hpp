@@ -1,9 +1,11 @@
 #pragma once
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/flavor/goblin_ultra.hpp"
 #include "barretenberg/flavor/ultra.hpp"
+#include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/pow.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/protogalaxy/folding_result.hpp"
@@ -35,6 +37,9 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         typename Flavor::template ProtogalaxyTupleOfTuplesOfUnivariates<ProverInstances::NUM>;
     using RelationEvaluations = typename Flavor::TupleOfArraysOfValues;
 
+    // The minimum number of rows (or tree leaves) for which we spin up a thread
+    static constexpr size_t MIN_ITERATIONS_PER_THREAD = 1 << 6;
+
     ProverInstances instances;
     BaseTranscript<FF> transcript;
 
@@ -57,15 +62,28 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     static std::vector<FF> compute_pow_polynomial_at_values(const std::vector<FF>& betas, const size_t instance_size)
     {
         std::vector<FF> pow_betas(instance_size);
-        for (size_t i = 0; i < instance_size; i++) {
+        // Blocks start at a multiple of their power of 2 size, so pow(start + j) = pow(start) * pow(j) and each
+        // block is built from its first value by doubling, with one multiplication per entry
+        const size_t num_threads =
+            numeric::is_power_of_two(instance_size)
+                ? barretenberg::thread_utils::calculate_num_threads_pow2(instance_size, MIN_ITERATIONS_PER_THREAD)
+                : 1;
+        const size_t block_size = instance_size / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * block_size;
             auto res = FF(1);
-            for (size_t j = i, beta_idx = 0; j > 0; j >>= 1, beta_idx++) {
+            for (size_t j = start, beta_idx = 0; j > 0; j >>= 1, beta_idx++) {
                 if ((j & 1) == 1) {
                     res *= betas[beta_idx];
                 }
             }
-            pow_betas[i] = res;
-        }
+            pow_betas[start] = res;
+            for (size_t half = 1, beta_idx = 0; half < block_size; half <<= 1, beta_idx++) {
+                for (size_t j = 0; j < half && half + j < block_size; j++) {
+                    pow_betas[start + half + j] = pow_betas[start + j] * betas[beta_idx];
+                }
+            }
+        });
         return pow_betas;
     }
 
@@ -101,53 +119,62 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         auto instance_size = instance_polynomials.get_polynomial_size();
 
         std::vector<FF> full_honk_evaluations(instance_size);
-        for (size_t row = 0; row < instance_size; row++) {
-            auto row_evaluations = instance_polynomials.get_row(row);
-            RelationEvaluations relation_evaluations;
-            Utils::zero_elements(relation_evaluations);
-
-            // Note that the evaluations are accumulated with the gate separation challenge being 1 at this stage, as
-            // this specific randomness is added later through the power polynomial univariate specific to ProtoGalaxy
-            Utils::template accumulate_relation_evaluations<>(
-                row_evaluations, relation_evaluations, relation_parameters, FF(1));
-
-            auto running_challenge = FF(1);
-            auto output = FF(0);
-            Utils::scale_and_batch_elements(relation_evaluations, alpha, running_challenge, output);
-            full_honk_evaluations[row] = output;
-        }
+        const size_t num_threads =
+            barretenberg::thread_utils::calculate_num_threads(instance_size, MIN_ITERATIONS_PER_THREAD);
+        const size_t rows_per_thread = (instance_size + num_threads - 1) / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * rows_per_thread;
+            const size_t end = std::min(start + rows_per_thread, instance_size);
+            for (size_t row = start; row < end; row++) {
+                auto row_evaluations = instance_polynomials.get_row(row);
+                RelationEvaluations relation_evaluations;
+                Utils::zero_elements(relation_evaluations);
+
+                // Note that the evaluations are accumulated with the gate separation challenge being 1 at this stage,
+                // as this specific randomness is added later through the power polynomial univariate specific to
+                // ProtoGalaxy
+                Utils::template accumulate_relation_evaluations<>(
+                    row_evaluations, relation_evaluations, relation_parameters, FF(1));
+
+                auto running_challenge = FF(1);
+                auto output = FF(0);
+                Utils::scale_and_batch_elements(relation_evaluations, alpha, running_challenge, output);
+                full_honk_evaluations[row] = output;
+            }
+        });
         return full_honk_evaluations;
     }
 
     /**
-     * @brief  Recursively compute the parent nodes of each level in there, starting from the leaves. Note that at each
-     * level, the resulting parent nodes will be polynomials of degree (level + 1) because we multiply by an additional
-     * factor of X.
+     * @brief Compute the levels [level_start, level_end) of the perturbator tree in place, starting from the nodes of
+     * level_start stored contiguously in `coeffs`.
+     * @details Nodes entering level i have i + 1 coefficients and their parents have i + 2. Parent j is written at
+     * offset j * (i + 2), which is never past its left child at 2j * (i + 1), and each coefficient only overwrites
+     * values that have already been read. Walking the parents in order therefore needs no scratch space.
      */
-    static std::vector<FF> construct_coefficients_tree(const std::vector<FF>& betas,
-                                                       const std::vector<FF>& deltas,
-                                                       const std::vector<std::vector<FF>>& prev_level_coeffs,
-                                                       size_t level = 1)
+    static void construct_coefficients_tree(std::span<FF> coeffs,
+                                            const std::vector<FF>& betas,
+                                            const std::vector<FF>& deltas,
+                                            const size_t level_start,
+                                            const size_t level_end)
     {
-        // if we are at level t in the tree, where t = logn and n is the instance size, we have reached the root which
-        // contains the coefficients of the perturbator polynomial
-        if (level == betas.size()) {
-            return prev_level_coeffs[0];
-        }
-
-        auto degree = level + 1;
-        auto prev_level_width = prev_level_coeffs.size();
-        // we need degree + 1 terms to represent the intermediate polynomials
-        std::vector<std::vector<FF>> level_coeffs(prev_level_width >> 1, std::vector<FF>(degree + 1, 0));
-        for (size_t node = 0; node < prev_level_width; node += 2) {
-            auto parent = node >> 1;
-            std::copy(prev_level_coeffs[node].begin(), prev_level_coeffs[node].end(), level_coeffs[parent].begin());
-            for (size_t d = 0; d < degree; d++) {
-                level_coeffs[parent][d] += prev_level_coeffs[node + 1][d] * betas[level];
-                level_coeffs[parent][d + 1] += prev_level_coeffs[node + 1][d] * deltas[level];
+        size_t width = coeffs.size() / (level_start + 1);
+        for (size_t level = level_start; level < level_end; level++) {
+            const size_t child_size = level + 1;
+            width >>= 1;
+            for (size_t parent = 0; parent < width; parent++) {
+                const size_t left = 2 * parent * child_size;
+                const size_t right = left + child_size;
+                const size_t node = parent * (child_size + 1);
+                for (size_t d = 0; d <= child_size; d++) {
+                    FF coeff = d < child_size ? coeffs[left + d] + coeffs[right + d] * betas[level] : FF(0);
+                    if (d > 0) {
+                        coeff += coeffs[right + d - 1] * deltas[level];
+                    }
+                    coeffs[node + d] = coeff;
+                }
             }
         }
-        return construct_coefficients_tree(betas, deltas, level_coeffs, level + 1);
     }
 
     /**
@@ -157,21 +184,38 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * the tree, label the branch connecting the left node n_l to its parent by 1 and for the right node n_r by β_i +
      * δ_i X. The value of the parent node n will be constructed as n = n_l + n_r * (β_i + δ_i X). Recurse over each
      * layer until the root is reached which will correspond to the perturbator polynomial F(X).
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/745): make computation of perturbator more memory
-     * efficient, operate in-place and use std::resize; add multithreading
+     * @details The tree is computed in place over the leaves. The lower levels are split into one subtree per thread
+     * and the subtree roots are then gathered at the front of the buffer to compute the remaining levels.
      */
     static std::vector<FF> construct_perturbator_coefficients(const std::vector<FF>& betas,
                                                               const std::vector<FF>& deltas,
-                                                              const std::vector<FF>& full_honk_evaluations)
+                                                              std::vector<FF> full_honk_evaluations)
     {
-        auto width = full_honk_evaluations.size();
-        std::vector<std::vector<FF>> first_level_coeffs(width >> 1, std::vector<FF>(2, 0));
-        for (size_t node = 0; node < width; node += 2) {
-            auto parent = node >> 1;
-            first_level_coeffs[parent][0] = full_honk_evaluations[node] + full_honk_evaluations[node + 1] * betas[0];
-            first_level_coeffs[parent][1] = full_honk_evaluations[node + 1] * deltas[0];
+        const size_t log_width = betas.size();
+        const size_t width = full_honk_evaluations.size();
+        ASSERT(width == (size_t(1) << log_width));
+        std::span<FF> coeffs(full_honk_evaluations);
+
+        const size_t num_threads =
+            barretenberg::thread_utils::calculate_num_threads_pow2(width, MIN_ITERATIONS_PER_THREAD);
+        const size_t subtree_width = width / num_threads;
+        const size_t subtree_depth = static_cast<size_t>(numeric::get_msb(subtree_width));
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            construct_coefficients_tree(
+                coeffs.subspan(thread_idx * subtree_width, subtree_width), betas, deltas, 0, subtree_depth);
+        });
+
+        const size_t root_size = subtree_depth + 1;
+        if (root_size < subtree_width) {
+            for (size_t thread_idx = 1; thread_idx < num_threads; thread_idx++) {
+                std::copy_n(&coeffs[thread_idx * subtree_width], root_size, &coeffs[thread_idx * root_size]);
+            }
         }
-        return construct_coefficients_tree(betas, deltas, first_level_coeffs);
+        construct_coefficients_tree(
+            coeffs.subspan(0, num_threads * root_size), betas, deltas, subtree_depth, log_width);
+
+        full_honk_evaluations.resize(log_width + 1);
+        return full_honk_evaluations;
     }
 
     /**
@@ -186,9 +230,9 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     {
         auto full_honk_evaluations =
             compute_full_honk_evaluations(accumulator->prover_polynomials, alpha, accumulator->relation_parameters);
-        const auto betas = accumulator->folding_parameters.gate_separation_challenges;
+        const auto& betas = accumulator->folding_parameters.gate_separation_challenges;
         assert(betas.size() == deltas.size());
-        auto coeffs = construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
+        auto coeffs = construct_perturbator_coefficients(betas, deltas, std::move(full_honk_evaluations));
         return Polynomial<FF>(coeffs);
     }
 
@@ -201,14 +245,15 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * construction.
      * @details For a fixed prover polynomial index, extract that polynomial from each instance in Instances. From each
      * polynomial, extract the value at row_idx. Use these values to create a univariate polynomial, and then extend
-     * (i.e., compute additional evaluations at adjacent domain values) as needed.
-     * @todo TODO(https://github.com/AztecProtocol/barretenberg/issues/751) Optimize memory
+     * (i.e., compute additional evaluations at adjacent domain values) as needed. The base univariates live on the
+     * stack, so the per-row work does not allocate.
      */
     void extend_univariates(ExtendedUnivariates& extended_univariates,
                             const ProverInstances& instances,
                             const size_t row_idx)
     {
-        auto base_univariates = instances.row_to_univariates(row_idx);
+        std::array<BaseUnivariate, Flavor::NUM_ALL_ENTITIES> base_univariates;
+        instances.row_to_univariates(base_univariates, row_idx);
         for (auto [extended_univariate, base_univariate] :
              zip_view(extended_univariates.pointer_view(), base_univariates)) {
             *extended_univariate = base_univariate.template extend_to<ExtendedUnivariate::LENGTH>();
@@ -246,12 +291,9 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
         // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
-        size_t max_num_threads = get_num_cpus_pow2(); // number of available threads (power of 2)
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t desired_num_threads = common_circuit_size / min_iterations_per_thread;
-        size_t num_threads = std::min(desired_num_threads, max_num_threads); // fewer than max if justified
-        num_threads = num_threads > 0 ? num_threads : 1;                     // ensure num threads is >= 1
-        size_t iterations_per_thread = common_circuit_size / num_threads;    // actual iterations per thread
+        size_t num_threads =
+            barretenberg::thread_utils::calculate_num_threads_pow2(common_circuit_size, MIN_ITERATIONS_PER_THREAD);
+        size_t iterations_per_thread = common_circuit_size / num_threads; // actual iterations per thread
 
         // Constuct univariate accumulator containers; one per thread
         std::vector<TupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
@@ -283,10 +325,14 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
             }
         });
 
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
-        for (auto& accumulators : thread_univariate_accumulators) {
-            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        // Accumulate the per-thread univariate accumulators pairwise, in log(num_threads) parallel steps
+        for (size_t stride = 1; stride < num_threads; stride <<= 1) {
+            parallel_for(num_threads / (2 * stride), [&](size_t pair_idx) {
+                Utils::add_nested_tuples(thread_univariate_accumulators[2 * stride * pair_idx],
+                                         thread_univariate_accumulators[2 * stride * pair_idx + stride]);
+            });
         }
+        Utils::add_nested_tuples(univariate_accumulators, thread_univariate_accumulators[0]);
         // Batch the univariate contributions from each sub-relation to obtain the round univariate
         return Utils::template batch_over_relations<ExtendedUnivariateWithRandomization>(univariate_accumulators,
                                                                                          alpha);
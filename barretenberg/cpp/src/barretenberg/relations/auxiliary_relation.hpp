@@ -49,6 +49,16 @@ template <typename FF_> class AuxiliaryRelationImpl {
         6  // RAM consistency sub-relation 3
     };
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities, typename Parameters>
+    inline static bool skip(const AllEntities& in, const Parameters& /*unused*/)
+    {
+        return in.q_aux.is_zero();
+    }
+
     /**
      * @brief Expression for the generalized permutation sort gate.
      * @details The following explanation is reproduced from the Plonk analog 'plookup_auxiliary_widget':
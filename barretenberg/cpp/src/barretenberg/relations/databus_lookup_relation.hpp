@@ -152,6 +152,16 @@ template <typename FF_> class DatabusLookupRelationImpl {
         return Accumulator(1);
     }
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     * @details Both subrelations vanish where the lookup is inactive and the inverse polynomial is zero.
+     */
+    template <typename AllEntities, typename Parameters>
+    inline static bool skip(const AllEntities& in, const Parameters& /*unused*/)
+    {
+        return in.q_busread.is_zero() && in.calldata_read_counts.is_zero() && in.lookup_inverses.is_zero();
+    }
+
     /**
      * @brief Accumulate the contribution from two surelations for the log derivative databus lookup argument
      * @details See lookup_library.hpp for details of the generic log-derivative lookup argument
@@ -18,6 +18,17 @@ template <typename FF_> class EccOpQueueRelationImpl {
         3  // op-queue-wire vanishes sub-relation 4
     };
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     * @details Away from the ecc op gates, the subrelations only constrain the op wires to be zero.
+     */
+    template <typename AllEntities, typename Parameters>
+    inline static bool skip(const AllEntities& in, const Parameters& /*unused*/)
+    {
+        return in.lagrange_ecc_op.is_zero() && in.ecc_op_wire_1.is_zero() && in.ecc_op_wire_2.is_zero() &&
+               in.ecc_op_wire_3.is_zero() && in.ecc_op_wire_4.is_zero();
+    }
+
     /**
      * @brief Expression for the generalized permutation sort gate.
      * @details The relation is defined as C(in(X)...) =
@@ -26,6 +26,16 @@ template <typename FF_> class EllipticRelationImpl {
         }
     }
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     *
+     */
+    template <typename AllEntities, typename Parameters>
+    inline static bool skip(const AllEntities& in, const Parameters& /*unused*/)
+    {
+        return in.q_elliptic.is_zero();
+    }
+
     /**
      * @brief Expression for the Ultra Arithmetic gate.
      * @details The relation is defined as C(in(X)...) =
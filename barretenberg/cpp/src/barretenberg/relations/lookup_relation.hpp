@@ -148,6 +148,25 @@ template <typename FF_> class LookupRelationImpl {
         return tmp;
     }
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     * @details Away from the first and last rows, with no lookup gate and no table or sorted values, the grand
+     * product subrelation reduces to γ(1 + β) ⋅ (γ(1 + β) ⋅ z_lookup - z_lookup_shift). This is the case on the
+     * padding rows, where z_lookup grows by γ(1 + β) per row.
+     */
+    template <typename AllEntities, typename Parameters>
+    inline static bool skip(const AllEntities& in, const Parameters& params)
+    {
+        if (!(in.lagrange_first.is_zero() && in.lagrange_last.is_zero() && in.q_lookup.is_zero() &&
+              in.table_1.is_zero() && in.table_2.is_zero() && in.table_3.is_zero() && in.table_4.is_zero() &&
+              in.table_1_shift.is_zero() && in.table_2_shift.is_zero() && in.table_3_shift.is_zero() &&
+              in.table_4_shift.is_zero() && in.sorted_accum.is_zero() && in.sorted_accum_shift.is_zero())) {
+            return false;
+        }
+        const FF gamma_by_one_plus_beta = params.gamma * (params.beta + FF(1));
+        return in.z_lookup * gamma_by_one_plus_beta == in.z_lookup_shift;
+    }
+
     /**
      * @brief Compute contribution of the lookup grand prod relation for a given edge (internal function)
      *
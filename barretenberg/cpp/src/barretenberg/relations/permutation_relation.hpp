@@ -67,6 +67,18 @@ template <typename FF_> class UltraPermutationRelationImpl {
                (w_4 + sigma_4 * beta + gamma);
     }
 
+    /**
+     * @brief Returns true if the contribution from all subrelations for the provided inputs is identically zero
+     * @details This is the case away from the first and last rows when z_perm is constant (z_perm = z_perm_shift)
+     * and the permutation is the identity (id_i = sigma_i), whatever the wires. Both hold on the padding rows.
+     */
+    template <typename AllEntities, typename Parameters>
+    inline static bool skip(const AllEntities& in, const Parameters& /*unused*/)
+    {
+        return in.lagrange_first.is_zero() && in.lagrange_last.is_zero() && in.z_perm == in.z_perm_shift &&
+               in.id_1 == in.sigma_1 && in.id_2 == in.sigma_2 && in.id_3 == in.sigma_3 && in.id_4 == in.sigma_4;
+    }
+
     /**
      * @brief Compute contribution of the permutation relation for a given edge (internal function)
      *
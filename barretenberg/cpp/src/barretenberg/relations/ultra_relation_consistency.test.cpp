@@ -551,4 +551,45 @@ TEST_F(UltraRelationConsistency, AuxiliaryRelation)
     run_test(/*random_inputs=*/true);
 };
 
+/**
+ * @brief Check that each relation's skip is true on a padding row, where the relation is zero, and false on random
+ * inputs.
+ */
+TEST_F(UltraRelationConsistency, SkipPaddingRows)
+{
+    const auto parameters = RelationParameters<FF>::get_random();
+
+    // Only the wires, the permutation and the grand products are non-zero on a padding row
+    InputElements padding_row;
+    std::fill(padding_row._data.begin(), padding_row._data.end(), FF(0));
+    padding_row.w_l = FF::random_element();
+    padding_row.w_r = FF::random_element();
+    padding_row.w_o = FF::random_element();
+    padding_row.w_4 = FF::random_element();
+    padding_row.id_1 = padding_row.sigma_1 = FF::random_element();
+    padding_row.id_2 = padding_row.sigma_2 = FF::random_element();
+    padding_row.id_3 = padding_row.sigma_3 = FF::random_element();
+    padding_row.id_4 = padding_row.sigma_4 = FF::random_element();
+    padding_row.z_perm = padding_row.z_perm_shift = FF::random_element();
+    padding_row.z_lookup = FF::random_element();
+    padding_row.z_lookup_shift = padding_row.z_lookup * parameters.gamma * (parameters.beta + FF(1));
+
+    const InputElements random_row = InputElements::get_random();
+
+    auto check_skip = [&]<typename Relation>() {
+        EXPECT_TRUE(Relation::skip(padding_row, parameters));
+        EXPECT_FALSE(Relation::skip(random_row, parameters));
+
+        typename Relation::SumcheckArrayOfValuesOverSubrelations expected_values;
+        std::fill(expected_values.begin(), expected_values.end(), FF(0));
+        validate_relation_execution<Relation>(expected_values, padding_row, parameters);
+    };
+    check_skip.template operator()<UltraArithmeticRelation<FF>>();
+    check_skip.template operator()<UltraPermutationRelation<FF>>();
+    check_skip.template operator()<LookupRelation<FF>>();
+    check_skip.template operator()<GenPermSortRelation<FF>>();
+    check_skip.template operator()<EllipticRelation<FF>>();
+    check_skip.template operator()<AuxiliaryRelation<FF>>();
+};
+
 } // namespace proof_system::ultra_relation_consistency_tests
@@ -5,13 +5,38 @@
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
+#include <memory>
 
 namespace barretenberg::pairing {
 struct miller_lines;
 } // namespace barretenberg::pairing
 
+namespace barretenberg::scalar_multiplication {
+template <typename Curve> class FixedBaseTable;
+} // namespace barretenberg::scalar_multiplication
+
 namespace barretenberg::srs::factories {
 
+/**
+ * Optional fixed-base precomputation for a prover crs, see scalar_multiplication::FixedBaseTable.
+ */
+struct FixedBaseConfig {
+    // Bytes the precomputed table may use. 0 disables the precomputation.
+    size_t memory_budget = 0;
+    // Keep the table next to the transcript files and reuse it across processes.
+    bool persist = false;
+};
+
+/**
+ * How a file-backed prover crs is loaded.
+ */
+struct ProverCrsConfig {
+    // Map the pippenger point table from a file next to the transcript files (see MappedPointTable) instead of reading
+    // the transcripts, writing that file from the transcripts first if it is missing or too short.
+    bool map_points = false;
+    FixedBaseConfig fixed_base;
+};
+
 /**
  * A prover crs representation.
  */
@@ -25,6 +50,10 @@ template <typename Curve> class ProverCrs {
      */
     virtual typename Curve::AffineElement* get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
+    /**
+     * @brief Returns the per-window multiples of the monomial points, if this crs precomputed them.
+     */
+    virtual std::shared_ptr<scalar_multiplication::FixedBaseTable<Curve>> get_fixed_base_table() { return nullptr; }
 };
 
 template <typename Curve> class VerifierCrs {
@@ -1,14 +1,95 @@
 #include "file_crs_factory.hpp"
 #include "../io.hpp"
+#include "./mapped_point_table.hpp"
+#include "barretenberg/common/log.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <functional>
+#include <map>
+#include <mutex>
 
 namespace barretenberg::srs::factories {
 
+/**
+ * @details Mappings are shared by every prover crs in the process, so the points validated for one degree are not
+ * validated again for the next.
+ */
+template <typename Curve>
+std::shared_ptr<typename Curve::AffineElement[]> map_point_table(
+    std::string const& path,
+    const size_t num_points,
+    std::function<void(typename Curve::AffineElement*)> const& fill_point_table)
+{
+    using AffineElement = typename Curve::AffineElement;
+    static std::mutex mutex;
+    static std::map<std::string, std::weak_ptr<MappedPointTable<Curve>>> mappings;
+
+    const std::string filename = path + "/pippenger_points.dat";
+    std::shared_ptr<MappedPointTable<Curve>> table;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        table = mappings[filename].lock();
+        if (!table || table->get_num_points() < num_points) {
+            table = MappedPointTable<Curve>::open(filename);
+        }
+        if (!table || table->get_num_points() < num_points) {
+            auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+            fill_point_table(points.get());
+            if (!MappedPointTable<Curve>::write(filename, points.get(), num_points)) {
+                info("could not write point table to ", filename);
+                return nullptr;
+            }
+            table = MappedPointTable<Curve>::open(filename);
+            if (!table) {
+                return nullptr;
+            }
+        }
+        mappings[filename] = table;
+    }
+    table->validate(num_points);
+    // Share ownership of the mapping with the points.
+    return std::shared_ptr<AffineElement[]>(table, table->get_points());
+}
+
+template <typename Curve>
+std::shared_ptr<scalar_multiplication::FixedBaseTable<Curve>> load_fixed_base_table(
+    typename Curve::AffineElement const* point_table,
+    const size_t num_points,
+    std::string const& path,
+    FixedBaseConfig const& config)
+{
+    using FixedBaseTable = scalar_multiplication::FixedBaseTable<Curve>;
+
+    if (config.memory_budget == 0 || num_points == 0) {
+        return nullptr;
+    }
+    const size_t window_bits = FixedBaseTable::get_window_bits(num_points, config.memory_budget);
+    if (window_bits == 0) {
+        info("fixed-base table for ", num_points, " points does not fit in ", config.memory_budget, "B");
+        return nullptr;
+    }
+    const bool persist = config.persist && !path.empty();
+    // The file name carries the window width, so a table built under a different budget is not picked up.
+    const std::string table_path =
+        path + "/fixed_base_" + std::to_string(num_points) + "_" + std::to_string(window_bits) + ".dat";
+    std::shared_ptr<FixedBaseTable> table;
+    if (persist) {
+        table = FixedBaseTable::read(table_path, point_table, num_points);
+    }
+    if (!table) {
+        table = std::make_shared<FixedBaseTable>(point_table, num_points, window_bits);
+        if (persist && !table->write(table_path)) {
+            info("could not write fixed-base table to ", table_path);
+        }
+    }
+    return table;
+}
+
 FileVerifierCrs<curve::BN254>::FileVerifierCrs(std::string const& path, const size_t)
     : precomputed_g2_lines(
           (barretenberg::pairing::miller_lines*)(aligned_alloc(64, sizeof(barretenberg::pairing::miller_lines) * 2)))
@@ -48,16 +129,37 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
 }
 
 template <typename Curve>
-FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
+FileProverCrs<Curve>::FileProverCrs(const size_t num_points,
+                                    std::string const& path,
+                                    ProverCrsConfig const& prover_crs_config)
+    : num_points(num_points)
+{
+    if (prover_crs_config.map_points && num_points != 0) {
+        monomials_ = map_point_table<Curve>(path, num_points, [&](typename Curve::AffineElement* point_table) {
+            srs::IO<Curve>::read_transcript_g1(point_table, num_points, path);
+            scalar_multiplication::generate_pippenger_point_table<Curve>(point_table, point_table, num_points);
+        });
+    }
+    if (!monomials_) {
+        monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    }
+    fixed_base_table_ = load_fixed_base_table<Curve>(monomials_.get(), num_points, path, prover_crs_config.fixed_base);
+}
+
+template <typename Curve>
+FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree, ProverCrsConfig prover_crs_config)
     : path_(std::move(path))
     , degree_(initial_degree)
+    , prover_crs_config_(prover_crs_config)
 {}
 
 template <typename Curve>
 std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get_prover_crs(size_t degree)
 {
     if (degree != degree_ || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_, prover_crs_config_);
         degree_ = degree;
     }
     return prover_crs_;
@@ -73,6 +175,14 @@ std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> FileCrsFactory
     return verifier_crs_;
 }
 
+template std::shared_ptr<curve::BN254::AffineElement[]> map_point_table<curve::BN254>(
+    std::string const&, size_t, std::function<void(curve::BN254::AffineElement*)> const&);
+template std::shared_ptr<curve::Grumpkin::AffineElement[]> map_point_table<curve::Grumpkin>(
+    std::string const&, size_t, std::function<void(curve::Grumpkin::AffineElement*)> const&);
+template std::shared_ptr<scalar_multiplication::FixedBaseTable<curve::BN254>> load_fixed_base_table<curve::BN254>(
+    curve::BN254::AffineElement const*, size_t, std::string const&, FixedBaseConfig const&);
+template std::shared_ptr<scalar_multiplication::FixedBaseTable<curve::Grumpkin>> load_fixed_base_table<curve::Grumpkin>(
+    curve::Grumpkin::AffineElement const*, size_t, std::string const&, FixedBaseConfig const&);
 template class FileProverCrs<curve::BN254>;
 template class FileProverCrs<curve::Grumpkin>;
 template class FileCrsFactory<curve::BN254>;
@@ -2,20 +2,47 @@
 #include "../io.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "crs_factory.hpp"
 #include <cstddef>
+#include <functional>
+#include <string>
 #include <utility>
 
 namespace barretenberg::srs::factories {
 
+/**
+ * @brief Map the pippenger point table for num_points points from pippenger_points.dat in `path` (see
+ * MappedPointTable). If that file is missing or short, it is first written from a table filled in by fill_point_table.
+ *
+ * @return nullptr if the table can't be mapped
+ */
+template <typename Curve>
+std::shared_ptr<typename Curve::AffineElement[]> map_point_table(
+    std::string const& path,
+    size_t num_points,
+    std::function<void(typename Curve::AffineElement*)> const& fill_point_table);
+
+/**
+ * @brief The fixed-base table for the num_points points behind point_table, as `config` asks for, or nullptr if it
+ * asks for none or none fits its budget. With persist set and a non-empty `path`, the table is read from (or, once
+ * built, written to) a file in `path`.
+ */
+template <typename Curve>
+std::shared_ptr<scalar_multiplication::FixedBaseTable<Curve>> load_fixed_base_table(
+    typename Curve::AffineElement const* point_table,
+    size_t num_points,
+    std::string const& path,
+    FixedBaseConfig const& config);
+
 /**
  * Create reference strings given a path to a directory of transcript files.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
-    FileCrsFactory(std::string path, size_t initial_degree = 0);
+    FileCrsFactory(std::string path, size_t initial_degree = 0, ProverCrsConfig prover_crs_config = {});
     FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
@@ -25,28 +52,34 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   private:
     std::string path_;
     size_t degree_;
+    ProverCrsConfig prover_crs_config_;
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> prover_crs_;
     std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> verifier_crs_;
 };
 
 template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
   public:
-    FileProverCrs(const size_t num_points, std::string const& path)
-        : num_points(num_points)
-    {
-        monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
-
-        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
-    };
+    /**
+     * @param prover_crs_config With map_points set, the points are mapped from pippenger_points.dat in the transcript
+     * directory (see MappedPointTable). If the fixed-base config has a memory budget, also precompute a fixed-base
+     * table within it. With persist set, that table is read from (or, once built, written to) a file in the
+     * transcript directory.
+     */
+    FileProverCrs(const size_t num_points, std::string const& path, ProverCrsConfig const& prover_crs_config = {});
 
     typename Curve::AffineElement* get_monomial_points() { return monomials_.get(); }
 
     size_t get_monomial_size() const { return num_points; }
 
+    std::shared_ptr<scalar_multiplication::FixedBaseTable<Curve>> get_fixed_base_table() override
+    {
+        return fixed_base_table_;
+    }
+
   private:
     size_t num_points;
     std::shared_ptr<typename Curve::AffineElement[]> monomials_;
+    std::shared_ptr<scalar_multiplication::FixedBaseTable<Curve>> fixed_base_table_;
 };
 
 template <typename Curve> class FileVerifierCrs : public VerifierCrs<Curve> {
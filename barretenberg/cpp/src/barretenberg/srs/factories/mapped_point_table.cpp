@@ -0,0 +1,162 @@
+#include "mapped_point_table.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/temp_file.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#if !defined(__wasm__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BB_MMAP_SUPPORTED 1
+#endif
+
+namespace barretenberg::srs::factories {
+
+namespace {
+
+// "BBPTTAB1": format version 1.
+constexpr uint64_t MAPPED_POINT_TABLE_MAGIC = 0x3142415454504242ULL;
+// The points start one page into the file, so they are page (and therefore cache line) aligned in memory.
+constexpr size_t MAPPED_POINT_TABLE_HEADER_SIZE = 4096;
+// Points validated per task.
+constexpr size_t VALIDATION_CHUNK_SIZE = 1 << 14;
+
+struct MappedPointTableHeader {
+    uint64_t magic;
+    // Low limb of the base field modulus, so a table for one curve is never mapped as another.
+    uint64_t curve_id;
+    uint64_t point_size;
+    uint64_t num_points;
+};
+
+template <typename Curve> MappedPointTableHeader make_header(const size_t num_points)
+{
+    return { MAPPED_POINT_TABLE_MAGIC,
+             Curve::BaseField::modulus.data[0],
+             sizeof(typename Curve::AffineElement),
+             num_points };
+}
+
+} // namespace
+
+template <typename Curve>
+MappedPointTable<Curve>::MappedPointTable(void* mapping,
+                                          const size_t mapping_size,
+                                          AffineElement* points,
+                                          const size_t num_points)
+    : mapping(mapping)
+    , mapping_size(mapping_size)
+    , points(points)
+    , num_points(num_points)
+{}
+
+template <typename Curve> MappedPointTable<Curve>::~MappedPointTable()
+{
+#ifdef BB_MMAP_SUPPORTED
+    munmap(mapping, mapping_size);
+#endif
+}
+
+template <typename Curve>
+std::shared_ptr<MappedPointTable<Curve>> MappedPointTable<Curve>::open(const std::string& filename)
+{
+#ifdef BB_MMAP_SUPPORTED
+    const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    MappedPointTableHeader header{};
+    const bool header_ok = fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= MAPPED_POINT_TABLE_HEADER_SIZE &&
+                           pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header));
+    const MappedPointTableHeader expected = make_header<Curve>(header.num_points);
+    // A corrupt point count must not wrap the table size around to something the file appears to hold.
+    constexpr size_t max_num_points = (SIZE_MAX - MAPPED_POINT_TABLE_HEADER_SIZE) / (2 * sizeof(AffineElement));
+    const bool num_points_ok = header.num_points != 0 && header.num_points <= max_num_points;
+    const size_t table_size = num_points_ok ? 2 * header.num_points * sizeof(AffineElement) : 0;
+    if (!header_ok || !num_points_ok || header.magic != expected.magic || header.curve_id != expected.curve_id ||
+        header.point_size != expected.point_size ||
+        static_cast<size_t>(st.st_size) < MAPPED_POINT_TABLE_HEADER_SIZE + table_size) {
+        close(fd);
+        return nullptr;
+    }
+    const auto mapping_size = static_cast<size_t>(st.st_size);
+    void* mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // The mapping holds its own reference to the file.
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+    auto* points = reinterpret_cast<AffineElement*>(static_cast<char*>(mapping) + MAPPED_POINT_TABLE_HEADER_SIZE);
+    return std::shared_ptr<MappedPointTable>(new MappedPointTable(mapping, mapping_size, points, header.num_points));
+#else
+    static_cast<void>(filename);
+    return nullptr;
+#endif
+}
+
+template <typename Curve>
+bool MappedPointTable<Curve>::write(const std::string& filename,
+                                    const AffineElement* point_table,
+                                    const size_t num_points)
+{
+    const std::string temp_filename = unique_temp_filename(filename);
+    {
+        std::ofstream file(temp_filename, std::ios::binary | std::ios::trunc);
+        std::vector<char> header(MAPPED_POINT_TABLE_HEADER_SIZE, 0);
+        const MappedPointTableHeader fields = make_header<Curve>(num_points);
+        std::copy_n(reinterpret_cast<const char*>(&fields), sizeof(fields), header.begin());
+        file.write(header.data(), static_cast<std::streamsize>(header.size()));
+        file.write(reinterpret_cast<const char*>(point_table),
+                   static_cast<std::streamsize>(2 * num_points * sizeof(AffineElement)));
+        if (!file) {
+            std::remove(temp_filename.c_str());
+            return false;
+        }
+    }
+    return std::rename(temp_filename.c_str(), filename.c_str()) == 0;
+}
+
+template <typename Curve> void MappedPointTable<Curve>::validate(const size_t num_points)
+{
+    using Fq = typename Curve::BaseField;
+
+    ASSERT(num_points <= this->num_points);
+    std::lock_guard<std::mutex> lock(validation_mutex);
+    if (num_points <= num_validated_points) {
+        return;
+    }
+    const Fq beta = Fq::cube_root_of_unity();
+    const size_t start = num_validated_points;
+    const size_t num_chunks = (num_points - start + VALIDATION_CHUNK_SIZE - 1) / VALIDATION_CHUNK_SIZE;
+    std::atomic<bool> valid = true;
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t chunk_start = start + chunk * VALIDATION_CHUNK_SIZE;
+        const size_t chunk_end = std::min(chunk_start + VALIDATION_CHUNK_SIZE, num_points);
+        for (size_t i = chunk_start; i < chunk_end && valid.load(std::memory_order_relaxed); ++i) {
+            const AffineElement& point = points[2 * i];
+            const AffineElement& endo_point = points[2 * i + 1];
+            if (point.is_point_at_infinity() || !point.on_curve() || endo_point.x != beta * point.x ||
+                endo_point.y != -point.y) {
+                valid = false;
+            }
+        }
+    });
+    if (!valid) {
+        throw_or_abort(format("Invalid point in mapped point table among points ", start, " to ", num_points, "."));
+    }
+    num_validated_points = num_points;
+}
+
+template class MappedPointTable<curve::BN254>;
+template class MappedPointTable<curve::Grumpkin>;
+
+} // namespace barretenberg::srs::factories
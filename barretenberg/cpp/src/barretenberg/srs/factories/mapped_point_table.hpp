@@ -0,0 +1,71 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace barretenberg::srs::factories {
+
+/**
+ * A pippenger point table ([P_0, \lambda P_0, P_1, \lambda P_1, ...]) stored in a file in memory layout (Montgomery
+ * form, native byte order) and mapped into memory rather than read.
+ *
+ * The transcript format stores big-endian points in standard form, so loading it means reading every point, converting
+ * it and computing the endomorphism table, all into private memory. A mapped table needs none of that: pages are
+ * faulted in from the page cache as the points are first used, so a prover only pays for the degree it works at, and
+ * processes on the same host share one physical copy of the points.
+ *
+ * Validation is lazy for the same reason. Opening checks only the header; `validate(n)` checks the first n points
+ * (on the curve, endomorphism entries consistent), and points that have been validated once are not checked again.
+ *
+ * The mapping is private and writable, so writing to the points (which no caller should do) only copies the pages
+ * written to.
+ */
+template <typename Curve> class MappedPointTable {
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    MappedPointTable(const MappedPointTable& other) = delete;
+    MappedPointTable& operator=(const MappedPointTable& other) = delete;
+    ~MappedPointTable();
+
+    /**
+     * @brief Map a table written by `write`.
+     *
+     * @return nullptr if the file is missing, truncated, or was written for another curve or format version
+     */
+    static std::shared_ptr<MappedPointTable> open(const std::string& filename);
+
+    /**
+     * @brief Write the pippenger point table of num_points SRS points, via a temporary file so a concurrent reader
+     * never sees a partial table.
+     *
+     * @return false if the file could not be written
+     */
+    static bool write(const std::string& filename, const AffineElement* point_table, size_t num_points);
+
+    /**
+     * @brief Check the points of the first num_points SRS points, if not already checked. Throws if one is invalid.
+     */
+    void validate(size_t num_points);
+
+    AffineElement* get_points() const { return points; }
+    size_t get_num_points() const { return num_points; }
+
+  private:
+    MappedPointTable(void* mapping, size_t mapping_size, AffineElement* points, size_t num_points);
+
+    void* mapping;
+    size_t mapping_size;
+    AffineElement* points;
+    size_t num_points;
+    std::mutex validation_mutex;
+    size_t num_validated_points = 0;
+};
+
+extern template class MappedPointTable<curve::BN254>;
+extern template class MappedPointTable<curve::Grumpkin>;
+
+} // namespace barretenberg::srs::factories
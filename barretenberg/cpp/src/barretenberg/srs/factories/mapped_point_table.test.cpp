@@ -0,0 +1,108 @@
+#include "mapped_point_table.hpp"
+#include "../io.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "file_crs_factory.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace barretenberg;
+using namespace barretenberg::srs::factories;
+
+namespace {
+
+template <typename Curve> class MappedPointTableTests : public ::testing::Test {};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+
+} // namespace
+
+TYPED_TEST_SUITE(MappedPointTableTests, Curves);
+
+TYPED_TEST(MappedPointTableTests, WriteOpenValidate)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    constexpr size_t num_points = 1000;
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    const std::string filename = ::testing::TempDir() + "mapped_point_table_test.dat";
+    ASSERT_TRUE(MappedPointTable<Curve>::write(filename, points, num_points));
+    auto table = MappedPointTable<Curve>::open(filename);
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(table->get_num_points(), num_points);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(table->get_points()) % 64, 0UL);
+    for (size_t i = 0; i < 2 * num_points; ++i) {
+        EXPECT_EQ(table->get_points()[i], points[i]);
+    }
+    table->validate(10);
+    table->validate(num_points);
+
+    // A table for the other curve, a missing file and a truncated file are not mapped.
+    using OtherCurve = std::conditional_t<std::is_same_v<Curve, curve::BN254>, curve::Grumpkin, curve::BN254>;
+    EXPECT_EQ(MappedPointTable<OtherCurve>::open(filename), nullptr);
+    EXPECT_EQ(MappedPointTable<Curve>::open(filename + ".missing"), nullptr);
+    std::remove(filename.c_str());
+    ASSERT_TRUE(MappedPointTable<Curve>::write(filename, points, num_points));
+    std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 1);
+    EXPECT_EQ(MappedPointTable<Curve>::open(filename), nullptr);
+
+    // Nor is a file whose point count would overflow the table size. The header's num_points is its fourth word.
+    ASSERT_TRUE(MappedPointTable<Curve>::write(filename, points, num_points));
+    for (uint64_t bad_num_points : { UINT64_MAX, (UINT64_MAX / (2 * sizeof(AffineElement))) + 1 }) {
+        std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(3 * sizeof(uint64_t));
+        file.write(reinterpret_cast<const char*>(&bad_num_points), sizeof(bad_num_points));
+        file.close();
+        EXPECT_EQ(MappedPointTable<Curve>::open(filename), nullptr);
+    }
+
+    // Points beyond the validated prefix are only checked when asked for.
+    points[2 * (num_points - 1) + 1].y = -points[2 * (num_points - 1) + 1].y;
+    ASSERT_TRUE(MappedPointTable<Curve>::write(filename, points, num_points));
+    table = MappedPointTable<Curve>::open(filename);
+    ASSERT_NE(table, nullptr);
+    table->validate(num_points - 1);
+    EXPECT_THROW(table->validate(num_points), std::runtime_error);
+    std::remove(filename.c_str());
+}
+
+TYPED_TEST(MappedPointTableTests, FileProverCrsMapsPoints)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    // A one-file transcript of random points.
+    constexpr size_t num_points = 300;
+    const std::string dir = ::testing::TempDir() + "mapped_point_table_crs";
+    std::filesystem::create_directories(dir + "/monomial");
+    std::vector<AffineElement> transcript_points(num_points);
+    for (auto& point : transcript_points) {
+        point = AffineElement(Element::random_element());
+    }
+    ::srs::Manifest manifest{ 0, 1, num_points, 0, num_points, 0, 0 };
+    ::srs::IO<Curve>::write_transcript(transcript_points.data(), manifest, dir);
+
+    FileProverCrs<Curve> read_crs(num_points, dir);
+    ProverCrsConfig config;
+    config.map_points = true;
+    // The first crs writes the point table, the second maps it, and a larger degree than the table rewrites it.
+    for (size_t degree : { num_points / 2, num_points / 3, num_points }) {
+        FileProverCrs<Curve> mapped_crs(degree, dir, config);
+        EXPECT_TRUE(std::filesystem::exists(dir + "/pippenger_points.dat"));
+        for (size_t i = 0; i < 2 * degree; ++i) {
+            EXPECT_EQ(mapped_crs.get_monomial_points()[i], read_crs.get_monomial_points()[i]);
+        }
+    }
+    std::filesystem::remove_all(dir);
+}
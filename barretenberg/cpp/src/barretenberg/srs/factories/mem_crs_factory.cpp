@@ -1,4 +1,6 @@
 #include "mem_crs_factory.hpp"
+#include "./file_crs_factory.hpp"
+#include "barretenberg/common/log.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
@@ -12,22 +14,46 @@ using namespace barretenberg::srs::factories;
 
 class MemProverCrs : public ProverCrs<curve::BN254> {
   public:
-    MemProverCrs(std::vector<g1::affine_element> const& points)
+    MemProverCrs(std::vector<g1::affine_element> const& points,
+                 ProverCrsConfig const& prover_crs_config,
+                 std::string const& path)
         : num_points(points.size())
     {
-        monomials_ = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
-        std::copy(points.begin(), points.end(), monomials_.get());
-        scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
-            monomials_.get(), monomials_.get(), num_points);
+        auto fill_point_table = [&](g1::affine_element* point_table) {
+            std::copy(points.begin(), points.end(), point_table);
+            scalar_multiplication::generate_pippenger_point_table<curve::BN254>(point_table, point_table, num_points);
+        };
+        if (prover_crs_config.map_points && !path.empty() && num_points != 0) {
+            monomials_ = map_point_table<curve::BN254>(path, num_points, fill_point_table);
+            // The table in `path` may have been written from other points, e.g. before the cache was replaced.
+            for (size_t i = 0; monomials_ && i < num_points; ++i) {
+                if (monomials_.get()[2 * i] != points[i]) {
+                    info("point table in ", path, " does not match the crs points, not mapping it");
+                    monomials_ = nullptr;
+                }
+            }
+        }
+        if (!monomials_) {
+            monomials_ = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+            fill_point_table(monomials_.get());
+        }
+        fixed_base_table_ =
+            load_fixed_base_table<curve::BN254>(monomials_.get(), num_points, path, prover_crs_config.fixed_base);
     }
 
     g1::affine_element* get_monomial_points() override { return monomials_.get(); }
 
     size_t get_monomial_size() const override { return num_points; }
 
+    std::shared_ptr<scalar_multiplication::FixedBaseTable<curve::BN254>> get_fixed_base_table() override
+    {
+        return fixed_base_table_;
+    }
+
   private:
     size_t num_points;
     std::shared_ptr<g1::affine_element[]> monomials_;
+    std::shared_ptr<scalar_multiplication::FixedBaseTable<curve::BN254>> fixed_base_table_;
 };
 
 class MemVerifierCrs : public VerifierCrs<curve::BN254> {
@@ -59,8 +85,11 @@ class MemVerifierCrs : public VerifierCrs<curve::BN254> {
 
 namespace barretenberg::srs::factories {
 
-MemCrsFactory::MemCrsFactory(std::vector<g1::affine_element> const& points, g2::affine_element const g2_point)
-    : prover_crs_(std::make_shared<MemProverCrs>(points))
+MemCrsFactory::MemCrsFactory(std::vector<g1::affine_element> const& points,
+                             g2::affine_element const g2_point,
+                             ProverCrsConfig const& prover_crs_config,
+                             std::string const& path)
+    : prover_crs_(std::make_shared<MemProverCrs>(points, prover_crs_config, path))
     , verifier_crs_(std::make_shared<MemVerifierCrs>(g2_point))
 {}
 
@@ -4,6 +4,7 @@
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "crs_factory.hpp"
 #include <cstddef>
+#include <string>
 #include <utility>
 
 namespace barretenberg::srs::factories {
@@ -11,11 +12,18 @@ namespace barretenberg::srs::factories {
 /**
  * Create reference strings given pointers to in memory buffers.
  *
- * This class is currently only used with wasm and works exclusively with the BN254 CRS.
+ * This class is used with wasm and by bb, and works exclusively with the BN254 CRS.
  */
 class MemCrsFactory : public CrsFactory<curve::BN254> {
   public:
-    MemCrsFactory(std::vector<g1::affine_element> const& points, g2::affine_element const g2_point);
+    /**
+     * @param prover_crs_config As for FileProverCrs, with `path` as the directory the point table is mapped from and
+     * the fixed-base table is persisted in. With no path, neither is kept in a file.
+     */
+    MemCrsFactory(std::vector<g1::affine_element> const& points,
+                  g2::affine_element const g2_point,
+                  ProverCrsConfig const& prover_crs_config = {},
+                  std::string const& path = "");
     MemCrsFactory(MemCrsFactory&& other) = default;
 
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<curve::BN254>> get_prover_crs(size_t degree) override;
@@ -3,6 +3,7 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "file_crs_factory.hpp"
+#include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
 
@@ -48,3 +49,45 @@ TEST(reference_string, grumpkin)
 {
     auto file_crs = FileCrsFactory<curve::Grumpkin>("../srs_db/grumpkin");
 }
+
+TEST(reference_string, mem_prover_crs_config)
+{
+    constexpr size_t num_points = 1024;
+    std::vector<g1::affine_element> points(num_points);
+    ::srs::IO<curve::BN254>::read_transcript_g1(points.data(), num_points, "../srs_db/ignition");
+    g2::affine_element g2_point;
+    ::srs::IO<curve::BN254>::read_transcript_g2(g2_point, "../srs_db/ignition");
+    auto expected = MemCrsFactory(points, g2_point).get_prover_crs(num_points);
+    EXPECT_EQ(expected->get_fixed_base_table(), nullptr);
+
+    const std::filesystem::path path = std::filesystem::path(::testing::TempDir()) / "mem_prover_crs_config";
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+    ProverCrsConfig config;
+    config.map_points = true;
+    config.fixed_base = { .memory_budget = 1UL << 24, .persist = true };
+    // Written on first use, read back by the second factory.
+    for (size_t i = 0; i < 2; ++i) {
+        auto prover_crs = MemCrsFactory(points, g2_point, config, path).get_prover_crs(num_points);
+        EXPECT_TRUE(std::filesystem::exists(path / "pippenger_points.dat"));
+        EXPECT_EQ(memcmp(prover_crs->get_monomial_points(),
+                         expected->get_monomial_points(),
+                         sizeof(g1::affine_element) * num_points * 2),
+                  0);
+        ASSERT_NE(prover_crs->get_fixed_base_table(), nullptr);
+        EXPECT_EQ(prover_crs->get_fixed_base_table()->get_num_points(), num_points);
+    }
+    size_t num_fixed_base_files = 0;
+    for (auto const& entry : std::filesystem::directory_iterator(path)) {
+        if (entry.path().filename().string().starts_with("fixed_base_")) {
+            ++num_fixed_base_files;
+        }
+    }
+    EXPECT_EQ(num_fixed_base_files, 1UL);
+
+    // A point table written from other points is not used.
+    std::vector<g1::affine_element> other_points(points.rbegin(), points.rend());
+    auto other_crs = MemCrsFactory(other_points, g2_point, config, path).get_prover_crs(num_points);
+    EXPECT_EQ(other_crs->get_monomial_points()[0], other_points[0]);
+    std::filesystem::remove_all(path);
+}
@@ -12,15 +12,18 @@ std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::Grumpkin>> grump
 namespace barretenberg::srs {
 
 // Initializes the crs using the memory buffers
-void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_element const g2_point)
+void init_crs_factory(std::vector<g1::affine_element> const& points,
+                      g2::affine_element const g2_point,
+                      factories::ProverCrsConfig const& prover_crs_config,
+                      std::string const& path)
 {
-    crs_factory = std::make_shared<factories::MemCrsFactory>(points, g2_point);
+    crs_factory = std::make_shared<factories::MemCrsFactory>(points, g2_point, prover_crs_config, path);
 }
 
 // Initializes crs from a file path this we use in the entire codebase
-void init_crs_factory(std::string crs_path)
+void init_crs_factory(std::string crs_path, factories::ProverCrsConfig prover_crs_config)
 {
-    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path);
+    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path, 0, prover_crs_config);
 }
 
 void init_grumpkin_crs_factory(std::string crs_path)
@@ -1,12 +1,15 @@
+#pragma once
 #include "./factories/crs_factory.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 
 namespace barretenberg::srs {
 void init_crs_factory(std::vector<barretenberg::g1::affine_element> const& points,
-                      barretenberg::g2::affine_element const g2_point);
+                      barretenberg::g2::affine_element const g2_point,
+                      factories::ProverCrsConfig const& prover_crs_config = {},
+                      std::string const& path = "");
 
-void init_crs_factory(std::string crs_path);
+void init_crs_factory(std::string crs_path, factories::ProverCrsConfig prover_crs_config = {});
 void init_grumpkin_crs_factory(std::string crs_path);
 
 std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::BN254>> get_crs_factory();
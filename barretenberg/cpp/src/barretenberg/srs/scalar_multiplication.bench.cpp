@@ -0,0 +1,60 @@
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace barretenberg;
+
+namespace {
+// The ignition transcript holds a little over 2^22 points.
+constexpr size_t MIN_LOG_NUM_POINTS = 16;
+constexpr size_t MAX_LOG_NUM_POINTS = 22;
+constexpr size_t MAX_NUM_POINTS = 1 << MAX_LOG_NUM_POINTS;
+
+auto reference_string =
+    std::make_shared<srs::factories::FileProverCrs<curve::BN254>>(MAX_NUM_POINTS, "../srs_db/ignition");
+
+const std::vector<fr>& get_scalars()
+{
+    static const std::vector<fr> scalars = []() {
+        std::vector<fr> result(MAX_NUM_POINTS);
+        for (auto& scalar : result) {
+            scalar = fr::random_element();
+        }
+        return result;
+    }();
+    return scalars;
+}
+} // namespace
+
+void pippenger_bench(State& state) noexcept
+{
+    const auto num_points = static_cast<size_t>(state.range(0));
+    // pippenger_unsafe takes non-const scalars but only reads them
+    auto* scalars = const_cast<fr*>(get_scalars().data());
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> runtime_state(num_points);
+    for (auto _ : state) {
+        DoNotOptimize(scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            scalars, reference_string->get_monomial_points(), num_points, runtime_state));
+    }
+}
+BENCHMARK(pippenger_bench)
+    ->RangeMultiplier(2)
+    ->Range(1 << MIN_LOG_NUM_POINTS, MAX_NUM_POINTS)
+    ->Unit(kMillisecond);
+
+void pippenger_signed_digit_bench(State& state) noexcept
+{
+    const auto num_points = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        DoNotOptimize(scalar_multiplication::pippenger_signed_digit_unsafe<curve::BN254>(
+            get_scalars().data(), reference_string->get_monomial_points(), num_points));
+    }
+}
+BENCHMARK(pippenger_signed_digit_bench)
+    ->RangeMultiplier(2)
+    ->Range(1 << MIN_LOG_NUM_POINTS, MAX_NUM_POINTS)
+    ->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
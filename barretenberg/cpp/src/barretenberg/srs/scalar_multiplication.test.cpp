@@ -12,12 +12,15 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digit_msm.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/io.hpp"
 
 #include <cstddef>
+#include <cstdio>
 #include <vector>
 
 namespace {
@@ -976,6 +979,285 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, PippengerSignedDigit)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // Sizes either side of the window width changes, including ones smaller than the number of threads.
+    for (size_t num_points : { 1UL, 3UL, 17UL, 1000UL, 8192UL }) {
+        std::vector<Fr> scalars(num_points);
+        auto point_table = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+        AffineElement* points = point_table.get();
+
+        for (size_t i = 0; i < num_points; ++i) {
+            scalars[i] = Fr::random_element();
+            points[i] = AffineElement(Element::random_element());
+        }
+        // Zero scalars are skipped and -1 is the largest scalar there is.
+        scalars[0] = Fr::zero();
+        scalars[num_points / 2] = -Fr::one();
+
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected += points[i] * scalars[i];
+        }
+        expected = expected.normalize();
+        barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+        Element result = barretenberg::scalar_multiplication::pippenger_signed_digit_unsafe<Curve>(
+            scalars.data(), points, num_points);
+        result = result.normalize();
+
+        EXPECT_EQ(result, expected) << "num_points = " << num_points;
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSignedDigitShortInputs)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 4096;
+
+    std::vector<Fr> scalars(num_points);
+    auto point_table = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+        switch (i % 4) {
+        case 0:
+            scalars[i] = Fr::random_element();
+            break;
+        case 1:
+            scalars[i] = Fr::zero();
+            break;
+        case 2:
+            scalars[i] = Fr(engine.get_random_uint32());
+            break;
+        default:
+            scalars[i] = Fr(engine.get_random_uint32() & 0x07U);
+            break;
+        }
+    }
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        expected += points[i] * scalars[i];
+    }
+    expected = expected.normalize();
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    Element result =
+        barretenberg::scalar_multiplication::pippenger_signed_digit_unsafe<Curve>(scalars.data(), points, num_points);
+    result = result.normalize();
+
+    EXPECT_EQ(result, expected);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSignedDigitBatch)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 2048;
+    auto point_table = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+
+    // MSMs of different lengths, including an empty one and an all-zero one.
+    std::vector<std::vector<Fr>> scalars;
+    for (size_t size : { num_points, 0UL, 5UL, num_points / 3, num_points }) {
+        std::vector<Fr> msm_scalars(size);
+        for (auto& scalar : msm_scalars) {
+            scalar = Fr::random_element();
+        }
+        scalars.emplace_back(msm_scalars);
+    }
+    std::fill(scalars.back().begin(), scalars.back().end(), Fr::zero());
+
+    std::vector<Element> expected(scalars.size());
+    for (size_t j = 0; j < scalars.size(); ++j) {
+        expected[j].self_set_infinity();
+        for (size_t i = 0; i < scalars[j].size(); ++i) {
+            expected[j] += points[i] * scalars[j][i];
+        }
+    }
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    std::vector<std::span<const Fr>> batch(scalars.begin(), scalars.end());
+    auto results = barretenberg::scalar_multiplication::pippenger_signed_digit_batch_unsafe<Curve>(batch, points);
+
+    ASSERT_EQ(results.size(), scalars.size());
+    for (size_t j = 0; j < scalars.size(); ++j) {
+        EXPECT_EQ(results[j].normalize(), expected[j].normalize()) << "msm " << j;
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSignedDigitSparse)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 2048;
+    auto point_table = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+
+    // A selector-like column, a read-count-like column, a mostly-zero column with a few full-width entries, and a
+    // column mixing every class including 2^64 - 1 and 2^64.
+    std::vector<std::vector<Fr>> scalars(4, std::vector<Fr>(num_points, Fr::zero()));
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[0][i] = Fr(engine.get_random_uint32() & 1U);
+        scalars[1][i] = Fr(engine.get_random_uint32() & 0xffU);
+        if (i % 97 == 0) {
+            scalars[2][i] = Fr::random_element();
+        }
+        switch (i % 5) {
+        case 0:
+            scalars[3][i] = Fr::random_element();
+            break;
+        case 1:
+            scalars[3][i] = Fr(uint256_t(engine.get_random_uint64()));
+            break;
+        case 2:
+            scalars[3][i] = Fr(uint256_t(0xffffffffffffffffULL));
+            break;
+        case 3:
+            scalars[3][i] = Fr(uint256_t(1) << 64);
+            break;
+        default:
+            break;
+        }
+    }
+
+    std::vector<Element> expected(scalars.size());
+    for (size_t j = 0; j < scalars.size(); ++j) {
+        expected[j].self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected[j] += points[i] * scalars[j][i];
+        }
+    }
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    std::vector<std::span<const Fr>> batch(scalars.begin(), scalars.end());
+    auto results = barretenberg::scalar_multiplication::pippenger_signed_digit_batch_unsafe<Curve>(batch, points);
+    for (size_t j = 0; j < scalars.size(); ++j) {
+        EXPECT_EQ(results[j].normalize(), expected[j].normalize()) << "msm " << j;
+        Element single = barretenberg::scalar_multiplication::pippenger_signed_digit_unsafe<Curve>(
+            scalars[j].data(), points, num_points);
+        EXPECT_EQ(single.normalize(), expected[j].normalize()) << "msm " << j;
+    }
+}
+
+TEST(ScalarMultiplication, SignedDigitWindowBits)
+{
+    using barretenberg::scalar_multiplication::get_signed_digit_window_bits;
+    // More points and more threads both favour wider windows (fewer reduction levels per bucket).
+    for (size_t num_threads : { 1UL, 16UL, 64UL }) {
+        size_t previous = 0;
+        for (size_t log_n = 4; log_n <= 24; log_n += 4) {
+            const size_t bits = get_signed_digit_window_bits(1UL << log_n, 128, num_threads);
+            EXPECT_GE(bits, previous);
+            EXPECT_GE(get_signed_digit_window_bits(1UL << log_n, 128, num_threads * 2), bits);
+            previous = bits;
+        }
+    }
+    EXPECT_GT(get_signed_digit_window_bits(1UL << 20, 128, 1), 10UL);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, FixedBaseTable)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+    using FixedBaseTable = barretenberg::scalar_multiplication::FixedBaseTable<Curve>;
+
+    constexpr size_t num_points = 1000;
+    auto point_table = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+
+    // Full-width scalars, a sparse 8-bit column, and a shorter polynomial.
+    std::vector<std::vector<Fr>> scalars{ std::vector<Fr>(num_points),
+                                          std::vector<Fr>(num_points, Fr::zero()),
+                                          std::vector<Fr>(num_points / 3) };
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[0][i] = Fr::random_element();
+        if (i % 7 == 0) {
+            scalars[1][i] = Fr(engine.get_random_uint32() & 0xffU);
+        }
+    }
+    for (auto& scalar : scalars[2]) {
+        scalar = Fr::random_element();
+    }
+    scalars[0][1] = -Fr::one();
+
+    std::vector<Element> expected(scalars.size());
+    for (size_t j = 0; j < scalars.size(); ++j) {
+        expected[j].self_set_infinity();
+        for (size_t i = 0; i < scalars[j].size(); ++i) {
+            expected[j] += points[i] * scalars[j][i];
+        }
+    }
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    std::vector<std::span<const Fr>> batch(scalars.begin(), scalars.end());
+    for (size_t window_bits : { 3UL, 8UL, 13UL }) {
+        FixedBaseTable table(points, num_points, window_bits);
+        auto results = table.batch_msm(batch);
+        for (size_t j = 0; j < scalars.size(); ++j) {
+            EXPECT_EQ(results[j].normalize(), expected[j].normalize()) << "window bits " << window_bits << " msm " << j;
+            EXPECT_EQ(table.msm(scalars[j]).normalize(), expected[j].normalize());
+        }
+    }
+
+    // The budget picks the window width.
+    EXPECT_EQ(FixedBaseTable::get_window_bits(num_points, 0), 0UL);
+    EXPECT_EQ(FixedBaseTable::get_window_bits(num_points, FixedBaseTable::get_table_size(num_points, 20) - 1), 0UL);
+    for (size_t budget : { 1UL << 22, 1UL << 24, 1UL << 30 }) {
+        const size_t window_bits = FixedBaseTable::get_window_bits(num_points, budget);
+        ASSERT_GT(window_bits, 0UL);
+        EXPECT_LE(FixedBaseTable::get_table_size(num_points, window_bits), budget);
+    }
+
+    // Round trip through a file, and reject files that do not match the points.
+    const std::string filename = ::testing::TempDir() + "fixed_base_table_test.dat";
+    FixedBaseTable table(points, num_points, 6);
+    ASSERT_TRUE(table.write(filename));
+    auto read_table = FixedBaseTable::read(filename, points, num_points);
+    ASSERT_NE(read_table, nullptr);
+    EXPECT_EQ(read_table->get_window_bits(), 6UL);
+    EXPECT_EQ(read_table->msm(scalars[0]).normalize(), expected[0].normalize());
+    EXPECT_EQ(FixedBaseTable::read(filename, points, num_points - 1), nullptr);
+    points[num_points] = AffineElement(Element::random_element());
+    EXPECT_EQ(FixedBaseTable::read(filename, points, num_points), nullptr);
+    EXPECT_EQ(FixedBaseTable::read(filename + ".missing", points, num_points), nullptr);
+    std::remove(filename.c_str());
+
+    // The table has no entries past its points.
+    const std::vector<Fr> too_many_scalars(num_points + 1, Fr::one());
+    EXPECT_THROW(table.msm(too_many_scalars), std::runtime_error);
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
 {
     using Curve = TypeParam;
@@ -6,6 +6,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <array>
 #include <vector>
 
 namespace proof_system::plonk::stdlib::merkle_tree {
@@ -20,6 +21,18 @@ inline barretenberg::fr hash_native(std::vector<barretenberg::fr> const& inputs)
     return crypto::pedersen_hash::hash(inputs); // uses lookup tables
 }
 
+/**
+ * Hashes consecutive pairs of `layer` with a single batched call, giving the next layer of the tree.
+ */
+inline std::vector<barretenberg::fr> compute_next_layer_native(std::vector<barretenberg::fr> const& layer)
+{
+    std::vector<std::array<barretenberg::fr, 2>> pairs(layer.size() / 2);
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        pairs[i] = { layer[i * 2], layer[i * 2 + 1] };
+    }
+    return crypto::pedersen_hash::hash_batch(pairs);
+}
+
 /**
  * Computes the root of a tree with leaves given as the vector `input`.
  *
@@ -33,11 +46,7 @@ inline barretenberg::fr compute_tree_root_native(std::vector<barretenberg::fr> c
     ASSERT(numeric::is_power_of_two(input.size()));
     auto layer = input;
     while (layer.size() > 1) {
-        std::vector<barretenberg::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-        }
-        layer = std::move(next_layer);
+        layer = compute_next_layer_native(layer);
     }
 
     return layer[0];
@@ -52,12 +61,8 @@ inline std::vector<barretenberg::fr> compute_tree_native(std::vector<barretenber
     auto layer = input;
     std::vector<barretenberg::fr> tree(input);
     while (layer.size() > 1) {
-        std::vector<barretenberg::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
-        layer = std::move(next_layer);
+        layer = compute_next_layer_native(layer);
+        tree.insert(tree.end(), layer.begin(), layer.end());
     }
 
     return tree;
@@ -1,6 +1,10 @@
 #pragma once
+#include "../hash.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
+#include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
+#include <algorithm>
+#include <map>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -86,31 +90,105 @@ class WrappedNullifierLeaf {
     std::optional<nullifier_leaf> data;
 };
 
-inline std::pair<size_t, bool> find_closest_leaf(std::vector<WrappedNullifierLeaf> const& leaves_, fr const& new_value)
+/**
+ * @brief Ordered map from the value of every non-empty leaf to its index, kept alongside the leaves so that the low
+ * leaf of a new value is found in O(log n).
+ */
+using NullifierLeafIndex = std::map<uint256_t, size_t>;
+
+/**
+ * @brief Find the leaf holding `new_value`, or else the leaf with the largest value below it (the "low leaf").
+ *
+ * @return The leaf index, and whether the value is already present
+ */
+inline std::pair<size_t, bool> find_closest_leaf(NullifierLeafIndex const& indices_by_value, fr const& new_value)
 {
-    std::vector<uint256_t> diff;
-    bool repeated = false;
     auto new_value_ = uint256_t(new_value);
+    auto it = indices_by_value.lower_bound(new_value_);
+    if (it != indices_by_value.end() && it->first == new_value_) {
+        return std::make_pair(it->second, true);
+    }
+    // The initial leaf has value 0, so every non-zero value has a low leaf
+    ASSERT(it != indices_by_value.begin());
+    return std::make_pair(std::prev(it)->second, false);
+}
 
-    for (size_t i = 0; i < leaves_.size(); i++) {
-
-        if (!leaves_[i].has_value()) {
-            diff.push_back(new_value_);
+/**
+ * @brief Insert a batch of values into `leaves`, returning the indices of all leaves that were modified.
+ *
+ * @details New leaves are appended in the order of `values`, skipping values that are already present, so the result
+ * is the same as inserting the values one at a time. The new values are then walked in sorted order, and each one
+ * links itself to its successor and its low leaf to itself, so every low leaf is updated once however many new values
+ * fall between it and its old successor.
+ *
+ * @param append_zero_leaves Whether a value of 0 appends an empty leaf (NullifierMemoryTree) or is treated as the
+ * initial leaf that is already present (NullifierTree)
+ */
+inline std::vector<size_t> insert_leaves(std::vector<WrappedNullifierLeaf>& leaves,
+                                         NullifierLeafIndex& indices_by_value,
+                                         std::vector<fr> const& values,
+                                         const bool append_zero_leaves)
+{
+    std::vector<size_t> modified_indices;
+    std::vector<NullifierLeafIndex::iterator> new_leaves;
+    new_leaves.reserve(values.size());
+    for (const auto& value : values) {
+        if (value == 0) {
+            if (append_zero_leaves) {
+                modified_indices.push_back(leaves.size());
+                leaves.push_back(WrappedNullifierLeaf::zero());
+            }
             continue;
         }
+        auto [it, inserted] = indices_by_value.try_emplace(uint256_t(value), leaves.size());
+        if (inserted) {
+            new_leaves.push_back(it);
+            leaves.push_back(WrappedNullifierLeaf::zero());
+        }
+    }
+
+    std::sort(new_leaves.begin(), new_leaves.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs->first < rhs->first;
+    });
+    for (const auto& it : new_leaves) {
+        const auto next = std::next(it);
+        const bool is_last = next == indices_by_value.end();
+        leaves[it->second].set({ .value = fr(it->first),
+                                 .nextIndex = is_last ? 0 : next->second,
+                                 .nextValue = is_last ? fr(0) : fr(next->first) });
+        modified_indices.push_back(it->second);
+
+        const auto low_leaf = std::prev(it);
+        leaves[low_leaf->second].set(
+            { .value = fr(low_leaf->first), .nextIndex = it->second, .nextValue = fr(it->first) });
+        modified_indices.push_back(low_leaf->second);
+    }
+
+    std::sort(modified_indices.begin(), modified_indices.end());
+    modified_indices.erase(std::unique(modified_indices.begin(), modified_indices.end()), modified_indices.end());
+    return modified_indices;
+}
 
-        auto leaf_value_ = uint256_t(leaves_[i].unwrap().value);
-        if (leaf_value_ > new_value_) {
-            diff.push_back(leaf_value_);
-        } else if (leaf_value_ == new_value_) {
-            repeated = true;
-            return std::make_pair(i, repeated);
-        } else {
-            diff.push_back(new_value_ - leaf_value_);
+/**
+ * @brief Hash the leaves at `indices` with one batched Pedersen call.
+ */
+inline std::vector<fr> hash_leaves(std::vector<WrappedNullifierLeaf> const& leaves, std::vector<size_t> const& indices)
+{
+    std::vector<std::array<fr, 3>> inputs;
+    inputs.reserve(indices.size());
+    for (const auto index : indices) {
+        if (leaves[index].has_value()) {
+            const auto leaf = leaves[index].unwrap();
+            inputs.push_back({ leaf.value, leaf.nextIndex, leaf.nextValue });
         }
     }
-    auto it = std::min_element(diff.begin(), diff.end());
-    return std::make_pair(static_cast<size_t>(it - diff.begin()), repeated);
+    auto leaf_hashes = crypto::pedersen_hash::hash_batch<3>(inputs);
+
+    std::vector<fr> hashes(indices.size());
+    for (size_t i = 0, j = 0; i < indices.size(); ++i) {
+        hashes[i] = leaves[indices[i]].has_value() ? leaf_hashes[j++] : fr::zero();
+    }
+    return hashes;
 }
 
 } // namespace merkle_tree
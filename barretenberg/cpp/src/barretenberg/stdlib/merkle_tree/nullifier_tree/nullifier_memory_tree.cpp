@@ -25,6 +25,7 @@ NullifierMemoryTree::NullifierMemoryTree(size_t depth)
     // Insert the initial leaf at index 0
     auto initial_leaf = WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves_.push_back(initial_leaf);
+    indices_by_value_.emplace(0, 0);
     root_ = update_element(0, initial_leaf.hash());
 }
 
@@ -41,7 +42,7 @@ fr NullifierMemoryTree::update_element(fr const& value)
 
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves_, value);
+    std::tie(current, is_already_present) = find_closest_leaf(indices_by_value_, value);
 
     nullifier_leaf current_leaf = leaves_[current].unwrap();
     nullifier_leaf new_leaf = { .value = value,
@@ -56,6 +57,7 @@ fr NullifierMemoryTree::update_element(fr const& value)
         leaves_[current].set(current_leaf);
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
+        indices_by_value_.emplace(uint256_t(value), leaves_.size());
         leaves_.push_back(new_leaf);
     }
 
@@ -72,6 +74,20 @@ fr NullifierMemoryTree::update_element(fr const& value)
     return root;
 }
 
+/**
+ * @brief Insert a block of values, giving the same tree as calling `update_element` on each in turn. Low leaves are
+ * updated once each and the modified leaves are hashed in one batch.
+ */
+fr NullifierMemoryTree::update_elements(std::vector<fr> const& values)
+{
+    auto modified_indices = insert_leaves(leaves_, indices_by_value_, values, /*append_zero_leaves=*/true);
+    auto leaf_hashes = hash_leaves(leaves_, modified_indices);
+    for (size_t i = 0; i < modified_indices.size(); ++i) {
+        update_element(modified_indices[i], leaf_hashes[i]);
+    }
+    return root_;
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
@@ -77,6 +77,7 @@ class NullifierMemoryTree : public MemoryTree {
     using MemoryTree::update_element;
 
     fr update_element(fr const& value);
+    fr update_elements(std::vector<fr> const& values);
 
     const std::vector<barretenberg::fr>& get_hashes() { return hashes_; }
     const WrappedNullifierLeaf get_leaf(size_t index)
@@ -91,6 +92,7 @@ class NullifierMemoryTree : public MemoryTree {
     using MemoryTree::root_;
     using MemoryTree::total_size_;
     std::vector<WrappedNullifierLeaf> leaves_;
+    NullifierLeafIndex indices_by_value_;
 };
 
 } // namespace merkle_tree
@@ -1,4 +1,5 @@
 #include "nullifier_memory_tree.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include <gtest/gtest.h>
 
 using namespace barretenberg;
@@ -368,4 +369,32 @@ TEST(crypto_nullifier_tree, test_nullifier_tree)
     // Merkle proof at `index` proves non-membership of `new_member`
     auto hash_path = tree.get_hash_path(index);
     EXPECT_TRUE(check_hash_path(tree.root(), hash_path, leaves[index].unwrap(), index));
-}
\ No newline at end of file
+}
+
+TEST(crypto_nullifier_tree, test_nullifier_memory_batch_insert)
+{
+    constexpr size_t depth = 6;
+    NullifierMemoryTree sequential_tree(depth);
+    NullifierMemoryTree batch_tree(depth);
+
+    // Random values, with repeats and zeros, inserted as two blocks
+    auto& engine = numeric::random::get_debug_engine();
+    std::vector<fr> values;
+    for (size_t i = 0; i < 24; i++) {
+        values.push_back(fr(engine.get_random_uint8()));
+    }
+    values.push_back(0);
+    values.push_back(values[3]);
+
+    const std::vector<fr> first_block(values.begin(), values.begin() + 10);
+    const std::vector<fr> second_block(values.begin() + 10, values.end());
+    for (const auto& value : values) {
+        sequential_tree.update_element(value);
+    }
+    batch_tree.update_elements(first_block);
+    auto root = batch_tree.update_elements(second_block);
+
+    EXPECT_EQ(root, sequential_tree.root());
+    EXPECT_EQ(batch_tree.get_leaves(), sequential_tree.get_leaves());
+    EXPECT_EQ(batch_tree.get_hashes(), sequential_tree.get_hashes());
+}
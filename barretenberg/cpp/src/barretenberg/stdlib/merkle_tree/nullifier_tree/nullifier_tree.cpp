@@ -32,6 +32,7 @@ NullifierTree<Store>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
     WrappedNullifierLeaf initial_leaf =
         WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves.push_back(initial_leaf);
+    indices_by_value.emplace(0, 0);
     update_element(0, initial_leaf.hash());
 
     // Create the zero hashes for the tree
@@ -45,6 +46,8 @@ NullifierTree<Store>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
 template <typename Store>
 NullifierTree<Store>::NullifierTree(NullifierTree&& other)
     : MerkleTree<Store>(std::move(other))
+    , leaves(std::move(other.leaves))
+    , indices_by_value(std::move(other.indices_by_value))
 {}
 
 template <typename Store> NullifierTree<Store>::~NullifierTree() {}
@@ -54,7 +57,7 @@ template <typename Store> fr NullifierTree<Store>::update_element(fr const& valu
     // Find the leaf with the value closest and less than `value`
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves, value);
+    std::tie(current, is_already_present) = find_closest_leaf(indices_by_value, value);
 
     nullifier_leaf current_leaf = leaves[current].unwrap();
     WrappedNullifierLeaf new_leaf = WrappedNullifierLeaf(
@@ -67,6 +70,7 @@ template <typename Store> fr NullifierTree<Store>::update_element(fr const& valu
         leaves[current].set(current_leaf);
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
+        indices_by_value.emplace(uint256_t(value), leaves.size());
         leaves.push_back(new_leaf);
     }
 
@@ -83,6 +87,20 @@ template <typename Store> fr NullifierTree<Store>::update_element(fr const& valu
     return r;
 }
 
+/**
+ * @brief Insert a block of values, giving the same tree as calling `update_element` on each in turn. Low leaves are
+ * updated once each and the modified leaves are hashed in one batch.
+ */
+template <typename Store> fr NullifierTree<Store>::update_elements(std::vector<fr> const& values)
+{
+    auto modified_indices = insert_leaves(leaves, indices_by_value, values, /*append_zero_leaves=*/false);
+    auto leaf_hashes = hash_leaves(leaves, modified_indices);
+    for (size_t i = 0; i < modified_indices.size(); ++i) {
+        update_element(modified_indices[i], leaf_hashes[i]);
+    }
+    return root();
+}
+
 template class NullifierTree<MemoryStore>;
 
 } // namespace merkle_tree
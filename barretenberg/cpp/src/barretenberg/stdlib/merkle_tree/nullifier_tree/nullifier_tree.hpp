@@ -24,6 +24,7 @@ template <typename Store> class NullifierTree : public MerkleTree<Store> {
     using MerkleTree<Store>::depth;
 
     fr update_element(fr const& value);
+    fr update_elements(std::vector<fr> const& values);
 
   private:
     using MerkleTree<Store>::update_element;
@@ -36,6 +37,7 @@ template <typename Store> class NullifierTree : public MerkleTree<Store> {
     using MerkleTree<Store>::depth_;
     using MerkleTree<Store>::tree_id_;
     std::vector<WrappedNullifierLeaf> leaves;
+    NullifierLeafIndex indices_by_value;
 };
 
 extern template class NullifierTree<MemoryStore>;
@@ -137,4 +137,60 @@ TEST(stdlib_nullifier_tree, test_get_hash_path_layers)
         EXPECT_EQ(before[1], after[1]);
         EXPECT_NE(before[2], after[2]);
     }
-}
\ No newline at end of file
+}
+
+TEST(stdlib_nullifier_tree, test_batch_insert_vs_memory)
+{
+    constexpr size_t depth = 8;
+    NullifierMemoryTree memdb(depth);
+
+    MemoryStore store;
+    NullifierTree db(store, depth);
+
+    // The second block repeats some values of the first
+    const std::vector<fr> first_block(VALUES.begin(), VALUES.begin() + 40);
+    const std::vector<fr> second_block(VALUES.begin() + 30, VALUES.begin() + 60);
+    for (const auto& value : first_block) {
+        memdb.update_element(value);
+    }
+    for (const auto& value : second_block) {
+        memdb.update_element(value);
+    }
+
+    db.update_elements(first_block);
+    EXPECT_EQ(db.update_elements(second_block), memdb.root());
+    for (size_t i = 0; i < 60; ++i) {
+        EXPECT_EQ(db.get_hash_path(i), memdb.get_hash_path(i));
+    }
+}
+
+TEST(stdlib_nullifier_tree, test_batch_insert_vs_sequential)
+{
+    constexpr size_t depth = 8;
+    MemoryStore sequential_store;
+    NullifierTree sequential_db(sequential_store, depth);
+    MemoryStore batch_store;
+    NullifierTree batch_db(batch_store, depth);
+
+    // Three blocks, the last of which repeats values from both earlier ones and from itself
+    std::vector<fr> values(VALUES.begin(), VALUES.begin() + 50);
+    values.push_back(VALUES[5]);
+    values.push_back(VALUES[45]);
+    values.push_back(VALUES[45]);
+    const std::vector<std::vector<fr>> blocks = { { values.begin(), values.begin() + 20 },
+                                                  { values.begin() + 20, values.begin() + 40 },
+                                                  { values.begin() + 40, values.end() } };
+
+    for (const auto& block : blocks) {
+        fr sequential_root;
+        for (const auto& value : block) {
+            sequential_root = sequential_db.update_element(value);
+        }
+        EXPECT_EQ(batch_db.update_elements(block), sequential_root);
+    }
+    // size() is one past the last leaf written, which for a repeated value is its existing leaf, so compare every
+    // path rather than the sizes
+    for (size_t i = 0; i < (1UL << depth); ++i) {
+        EXPECT_EQ(batch_db.get_hash_path(i), sequential_db.get_hash_path(i));
+    }
+}
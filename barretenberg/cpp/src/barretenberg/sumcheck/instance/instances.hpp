@@ -69,6 +69,19 @@ template <typename Flavor_, size_t NUM_> struct ProverInstances_ {
         return results;
     }
 
+    /**
+     * @brief As above, but writes into a caller-owned container with one univariate per column.
+     */
+    template <typename Univariates> void row_to_univariates(Univariates& results, size_t row_idx) const
+    {
+        for (size_t instance_idx = 0; instance_idx < NUM; instance_idx++) {
+            auto pointer_view = _data[instance_idx]->prover_polynomials.pointer_view();
+            for (auto [result, poly_ptr] : zip_view(results, pointer_view)) {
+                result.evaluations[instance_idx] = (*poly_ptr)[row_idx];
+            }
+        }
+    }
+
   private:
     auto get_polynomial_pointer_views() const
     {
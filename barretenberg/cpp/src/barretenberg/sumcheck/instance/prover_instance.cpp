@@ -40,6 +40,14 @@ template <class Flavor> void ProverInstance_<Flavor>::compute_circuit_size_param
 
     // Next power of 2
     dyadic_circuit_size = circuit.get_circuit_subgroup_size(total_num_gates);
+
+    // The padding runs from the end of the execution trace (and of the calldata) up to the row before the sorted list,
+    // the last row being the first row of the shifted sorted list
+    padding_start = num_rows_populated_in_execution_trace;
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        padding_start = std::max(padding_start, circuit.public_calldata.size());
+    }
+    padding_end = std::max(padding_start, dyadic_circuit_size - tables_size - lookups_size - 1);
 }
 
 /**
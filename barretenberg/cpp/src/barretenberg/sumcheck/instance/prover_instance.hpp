@@ -42,6 +42,10 @@ template <class Flavor> class ProverInstance_ {
     // non-zero  for Instances constructed from circuits, this concept doesn't exist for accumulated
     // instances
     size_t pub_inputs_offset = 0;
+    // The rows [padding_start, padding_end) between the execution trace and the sorted lookup list, which only pad the
+    // circuit to a power of 2 and on which every relation contributes nothing. Empty for accumulated instances
+    size_t padding_start = 0;
+    size_t padding_end = 0;
     proof_system::RelationParameters<FF> relation_parameters;
     std::vector<uint32_t> recursive_proof_public_input_indices;
     // non-empty for the accumulated instances
@@ -59,6 +59,18 @@ template <typename Flavor> class SumcheckProver {
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
 
+    /**
+     * @brief Whether to fold each round into the next round's univariate computation (see prove_fused_rounds). Off,
+     * each round is partially evaluated in a separate pass, in place in partially_evaluated_polynomials.
+     */
+    bool fuse_rounds = true;
+
+    /**
+     * @brief With fused rounds, the rounds alternate between partially_evaluated_polynomials and this (n / 4 rows),
+     * since a round cannot be folded in place while other threads still read it. Allocated by the first fused proof.
+     */
+    PartiallyEvaluatedMultivariates folded_polynomials;
+
     // prover instantiates sumcheck with circuit size and a prover transcript
     SumcheckProver(size_t multivariate_n, Transcript& transcript)
         : transcript(transcript)
@@ -90,6 +102,10 @@ template <typename Flavor> class SumcheckProver {
         transcript.send_to_verifier("Sumcheck:univariate_0", round_univariate);
         FF round_challenge = transcript.get_challenge("Sumcheck:u_0");
         multivariate_challenge.emplace_back(round_challenge);
+        if (fuse_rounds) {
+            return prove_fused_rounds(
+                full_polynomials, relation_parameters, pow_univariate, alpha, multivariate_challenge);
+        }
         partially_evaluate(full_polynomials, multivariate_n, round_challenge);
         pow_univariate.partially_evaluate(round_challenge);
         round.round_size =
@@ -120,12 +136,77 @@ template <typename Flavor> class SumcheckProver {
         return { multivariate_challenge, multivariate_evaluations };
     };
 
+    /**
+     * @brief The rounds after the first, each partially evaluating the previous round at its challenge in the same
+     * pass that computes its own univariate.
+     *
+     * @details Round l reads the rows folded by round l - 1 and writes its own folded rows to the other buffer: round
+     * 1 reads full_polynomials and writes partially_evaluated_polynomials, round 2 writes folded_polynomials, round 3
+     * partially_evaluated_polynomials again and so on. The final evaluations are left in row 0 of
+     * partially_evaluated_polynomials, as in the unfused prover.
+     */
+    SumcheckOutput<Flavor> prove_fused_rounds(ProverPolynomials& full_polynomials,
+                                              const proof_system::RelationParameters<FF>& relation_parameters,
+                                              barretenberg::PowUnivariate<FF>& pow_univariate,
+                                              const FF alpha,
+                                              std::vector<FF>& multivariate_challenge)
+    {
+        // The constructor allocates half the size it is given, so this is n / 4 rows
+        if (multivariate_d > 2 && folded_polynomials.pointer_view()[0]->size() < (multivariate_n >> 2)) {
+            folded_polynomials = PartiallyEvaluatedMultivariates(multivariate_n >> 1);
+        }
+        FF round_challenge = multivariate_challenge.back();
+        pow_univariate.partially_evaluate(round_challenge);
+        round.round_size = round.round_size >> 1;
+
+        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+            barretenberg::Univariate<FF, Flavor::BATCHED_RELATION_PARTIAL_LENGTH> round_univariate;
+            auto& folded = round_idx % 2 == 1 ? partially_evaluated_polynomials : folded_polynomials;
+            if (round_idx == 1) {
+                round_univariate = round.fold_and_compute_univariate(
+                    full_polynomials, folded, round_challenge, relation_parameters, pow_univariate, alpha);
+            } else {
+                auto& previous = round_idx % 2 == 1 ? folded_polynomials : partially_evaluated_polynomials;
+                round_univariate = round.fold_and_compute_univariate(
+                    previous, folded, round_challenge, relation_parameters, pow_univariate, alpha);
+            }
+            transcript.send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
+            round_challenge = transcript.get_challenge("Sumcheck:u_" + std::to_string(round_idx));
+            multivariate_challenge.emplace_back(round_challenge);
+            pow_univariate.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1;
+        }
+
+        // Final round: fold the last two rows at the last challenge into row 0 of partially_evaluated_polynomials
+        ClaimedEvaluations multivariate_evaluations;
+        auto fold_last_round = [&](const auto& previous) {
+            for (auto [eval, pep, poly] : zip_view(multivariate_evaluations.pointer_view(),
+                                                   partially_evaluated_polynomials.pointer_view(),
+                                                   previous.pointer_view())) {
+                *eval = (*poly)[0] + round_challenge * ((*poly)[1] - (*poly)[0]);
+                (*pep)[0] = *eval;
+            }
+        };
+        if (multivariate_d == 1) {
+            fold_last_round(full_polynomials);
+        } else if (multivariate_d % 2 == 0) {
+            fold_last_round(partially_evaluated_polynomials);
+        } else {
+            fold_last_round(folded_polynomials);
+        }
+        transcript.send_to_verifier("Sumcheck:evaluations", multivariate_evaluations);
+
+        return { multivariate_challenge, multivariate_evaluations };
+    }
+
     /**
      * @brief Compute univariate restriction place in transcript, generate challenge, partially evaluate,... repeat
-     * until final round, then compute multivariate evaluations and place in transcript.
+     * until final round, then compute multivariate evaluations and place in transcript. The rounds leave out the
+     * instance's padding rows.
      */
     SumcheckOutput<Flavor> prove(std::shared_ptr<Instance> instance)
     {
+        round.set_padding(instance->prover_polynomials, instance->padding_start, instance->padding_end);
         return prove(instance->prover_polynomials, instance->relation_parameters);
     };
 
@@ -150,10 +231,7 @@ template <typename Flavor> class SumcheckProver {
         auto poly_view = polynomials.pointer_view();
         // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(polynomials.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                (*pep_view[j])[i >> 1] =
-                    (*poly_view[j])[i] + round_challenge * ((*poly_view[j])[i + 1] - (*poly_view[j])[i]);
-            }
+            round.fold_polynomial(&(*poly_view[j])[0], &(*pep_view[j])[0], round_size >> 1, round_challenge, j);
         });
     };
     /**
@@ -166,10 +244,7 @@ template <typename Flavor> class SumcheckProver {
         auto pep_view = partially_evaluated_polynomials.pointer_view();
         // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(polynomials.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                (*pep_view[j])[i >> 1] =
-                    polynomials[j][i] + round_challenge * (polynomials[j][i + 1] - polynomials[j][i]);
-            }
+            round.fold_polynomial(&polynomials[j][0], &(*pep_view[j])[0], round_size >> 1, round_challenge, j);
         });
     };
 };
@@ -195,6 +195,55 @@ TEST_F(SumcheckTests, Prover)
     }
 }
 
+TEST_F(SumcheckTests, FusedRoundsMatchUnfused)
+{
+    // Enough rounds to alternate between the two fused buffers, with an odd and an even number of them. The larger
+    // sizes split their first rounds over 8 threads, whatever the number of cpus, so that threads fold and read
+    // neighbouring row ranges.
+    for (const auto& [multivariate_d, max_num_threads] :
+         std::vector<std::pair<size_t, size_t>>{ { 6, 1 }, { 7, 1 }, { 10, 8 }, { 11, 8 } }) {
+        const size_t multivariate_n(1 << multivariate_d);
+
+        std::array<barretenberg::Polynomial<FF>, NUM_POLYNOMIALS> random_polynomials;
+        for (auto& poly : random_polynomials) {
+            poly = random_poly(multivariate_n);
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+        Flavor::Transcript fused_transcript = Flavor::Transcript::prover_init_empty();
+        auto fused_sumcheck = SumcheckProver<Flavor>(multivariate_n, fused_transcript);
+        fused_sumcheck.round.max_num_threads = max_num_threads;
+        auto fused_output = fused_sumcheck.prove(full_polynomials, {});
+        // Rounds 2, 4, ... are folded into a buffer of n / 4 rows, the most any of them writes
+        EXPECT_EQ(fused_sumcheck.folded_polynomials.pointer_view()[0]->size(), multivariate_n / 4);
+
+        Flavor::Transcript unfused_transcript = Flavor::Transcript::prover_init_empty();
+        auto unfused_sumcheck = SumcheckProver<Flavor>(multivariate_n, unfused_transcript);
+        unfused_sumcheck.fuse_rounds = false;
+        auto unfused_output = unfused_sumcheck.prove(full_polynomials, {});
+
+        // Compare the round univariates one round at a time, so a mismatch points at the first round that differs
+        auto fused_reader = Flavor::Transcript::verifier_init_empty(fused_transcript);
+        auto unfused_reader = Flavor::Transcript::verifier_init_empty(unfused_transcript);
+        using RoundUnivariate = barretenberg::Univariate<FF, Flavor::BATCHED_RELATION_PARTIAL_LENGTH>;
+        for (size_t round_idx = 0; round_idx < multivariate_d; round_idx++) {
+            const std::string label = "Sumcheck:univariate_" + std::to_string(round_idx);
+            auto fused_univariate = fused_reader.template receive_from_prover<RoundUnivariate>(label);
+            auto unfused_univariate = unfused_reader.template receive_from_prover<RoundUnivariate>(label);
+            EXPECT_EQ(fused_univariate, unfused_univariate) << "d = " << multivariate_d << ", round " << round_idx;
+        }
+        EXPECT_EQ(fused_transcript.proof_data, unfused_transcript.proof_data);
+
+        // The challenges depend on every round univariate
+        EXPECT_EQ(fused_output.challenge, unfused_output.challenge);
+        auto fused_evaluations = fused_output.claimed_evaluations.pointer_view();
+        auto unfused_evaluations = unfused_output.claimed_evaluations.pointer_view();
+        for (auto [fused, unfused] : zip_view(fused_evaluations, unfused_evaluations)) {
+            EXPECT_EQ(*fused, *unfused);
+        }
+    }
+}
+
 // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
 TEST_F(SumcheckTests, ProverAndVerifierSimple)
 {
@@ -2,6 +2,7 @@
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/thread_utils.hpp"
+#include "barretenberg/ecc/fields/field_lanes.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/barycentric.hpp"
 #include "barretenberg/polynomials/pow.hpp"
@@ -61,6 +62,8 @@ template <typename Flavor> class SumcheckProverRound {
   public:
     using FF = typename Flavor::FF;
     using ExtendedEdges = typename Flavor::ExtendedEdges;
+    // The two values of each polynomial on an edge, before extension
+    using Edges = typename Flavor::template ProverUnivariates<2>;
 
     size_t round_size; // a power of 2
 
@@ -68,33 +71,92 @@ template <typename Flavor> class SumcheckProverRound {
     static constexpr size_t MAX_PARTIAL_RELATION_LENGTH = Flavor::MAX_PARTIAL_RELATION_LENGTH;
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = Flavor::BATCHED_RELATION_PARTIAL_LENGTH;
 
+    // Minimum number of edges for which we'll spin up a unique thread.
+    static constexpr size_t MIN_ITERATIONS_PER_THREAD = 1 << 6;
+
+    // Most threads a round is split over, a power of 2. Defaults to the number of cpus; tests raise it to cover the
+    // multithreaded paths on any machine.
+    size_t max_num_threads = get_num_cpus_pow2();
+
     SumcheckTupleOfTuplesOfUnivariates univariate_accumulators;
 
+    // The rows of the first round set as padding by set_padding, and whether each polynomial, in pointer_view order,
+    // is zero on them
+    size_t padding_start = 0;
+    size_t padding_end = 0;
+    std::array<bool, Flavor::NUM_ALL_ENTITIES> zero_on_padding{};
+
+    // The number of edges each round has read, i.e. those outside its padding edges
+    std::vector<size_t> num_edges_read_per_round;
+
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
+        , initial_round_size(initial_round_size)
     {
         // Initialize univariate accumulators to 0
         Utils::zero_univariates(univariate_accumulators);
+        // Allocate the per-thread workspace for the largest round up front; later rounds use a prefix of it.
+        reserve_workspace(initial_round_size);
     }
 
     /**
-     * @brief Extend each edge in the edge group at to max-relation-length-many values.
-     *
-     * @details Should only be called externally with relation_idx equal to 0.
-     * In practice, multivariates is one of ProverPolynomials or FoldedPolynomials.
+     * @brief Set the rows [start, end) of the first round's polynomials as padding, on which every relation is known to
+     * contribute nothing, such as the rows that pad a circuit to a power of 2.
      *
+     * @details Each round then leaves out the edges that lie entirely within the padding rows: they are neither read
+     * nor extended, and the polynomials that are zero on the padding rows are not folded there either. The others
+     * (the permutation grand product, say) are still folded across the padding, as later rounds and the final
+     * evaluations depend on them.
      */
     template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
-    void extend_edges(ExtendedEdges& extended_edges,
-                      const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
-                      size_t edge_idx)
+    void set_padding(const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials, size_t start, size_t end)
+    {
+        padding_start = start;
+        padding_end = std::max(start, end);
+        auto polynomial_view = polynomials.pointer_view();
+        parallel_for(polynomial_view.size(), [&](size_t j) {
+            const auto& polynomial = *polynomial_view[j];
+            bool is_zero = true;
+            for (size_t i = padding_start; i < padding_end && is_zero; ++i) {
+                is_zero = polynomial[i].is_zero();
+            }
+            zero_on_padding[j] = is_zero;
+        });
+    }
+
+    /**
+     * @brief The edges of a round of the given size that lie entirely within the padding rows, as a range [first, last)
+     * of edge indices, edge k being rows 2k and 2k + 1. Each row of the round stands for initial_round_size / size rows
+     * of the first round.
+     */
+    std::pair<size_t, size_t> get_padding_edges(size_t size) const
     {
-        for (auto [extended_edge, multivariate] :
-             zip_view(extended_edges.pointer_view(), multivariates.pointer_view())) {
-            auto edge = barretenberg::Univariate<FF, 2>({ (*multivariate)[edge_idx], (*multivariate)[edge_idx + 1] });
-            *extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+        const size_t rows_per_edge = 2 * (initial_round_size / size);
+        const size_t first = (padding_start + rows_per_edge - 1) / rows_per_edge;
+        const size_t last = padding_end / rows_per_edge;
+        if (first >= last) {
+            return { 0, 0 };
         }
+        return { first, last };
+    }
+
+    /**
+     * @brief Fold the polynomial with index poly_idx from the previous round to a round of the given size, at the
+     * previous round's challenge. A polynomial that is zero on the padding rows is only folded outside the round's
+     * padding edges. folded may be previous.
+     */
+    void fold_polynomial(const FF* previous, FF* folded, size_t size, const FF& challenge, size_t poly_idx) const
+    {
+        const auto [first, last] = get_padding_edges(size);
+        if (!zero_on_padding[poly_idx] || first == last) {
+            barretenberg::field_lanes::interpolate_pairs(previous, challenge, folded, size);
+            return;
+        }
+        barretenberg::field_lanes::interpolate_pairs(previous, challenge, folded, 2 * first);
+        barretenberg::field_lanes::interpolate_pairs(
+            previous + 4 * last, challenge, folded + 2 * last, size - 2 * last);
+        zero_padding_boundary(folded, first, last);
     }
 
     /**
@@ -109,42 +171,109 @@ template <typename Flavor> class SumcheckProverRound {
         const barretenberg::PowUnivariate<FF>& pow_univariate,
         const FF alpha)
     {
-        // Precompute the vector of required powers of zeta
-        // TODO(luke): Parallelize this
-        std::vector<FF> pow_challenges(round_size >> 1);
-        pow_challenges[0] = pow_univariate.partial_evaluation_constant;
-        for (size_t i = 1; i < (round_size >> 1); ++i) {
-            pow_challenges[i] = pow_challenges[i - 1] * pow_univariate.zeta_pow_sqr;
-        }
+        return compute_univariate_over_edges(
+            polynomials, relation_parameters, pow_univariate, alpha, [](size_t /*unused*/) {});
+    }
 
+    /**
+     * @brief Partially evaluate the previous round's polynomials at its challenge, writing the result to
+     * folded_polynomials, and compute this round's univariate from it in the same pass.
+     *
+     * @details round_size is this round's size, so the previous round's polynomials have 2 * round_size rows. Each
+     * edge is folded just before it is extended, while its rows are still in cache, and the work is split over row
+     * ranges rather than over polynomials. The previous round's polynomials must not share memory with
+     * folded_polynomials.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename PartiallyEvaluatedMultivariates>
+    barretenberg::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> fold_and_compute_univariate(
+        const ProverPolynomialsOrPartiallyEvaluatedMultivariates& previous_polynomials,
+        PartiallyEvaluatedMultivariates& folded_polynomials,
+        const FF previous_round_challenge,
+        const proof_system::RelationParameters<FF>& relation_parameters,
+        const barretenberg::PowUnivariate<FF>& pow_univariate,
+        const FF alpha)
+    {
+        fold_padding_edges(previous_polynomials, folded_polynomials, previous_round_challenge);
+        auto fold_edge = [&](size_t edge_idx) {
+            for (auto [folded, previous] :
+                 zip_view(folded_polynomials.pointer_view(), previous_polynomials.pointer_view())) {
+                for (size_t i = edge_idx; i < edge_idx + 2; ++i) {
+                    (*folded)[i] =
+                        (*previous)[2 * i] + previous_round_challenge * ((*previous)[2 * i + 1] - (*previous)[2 * i]);
+                }
+            }
+        };
+        return compute_univariate_over_edges(folded_polynomials, relation_parameters, pow_univariate, alpha, fold_edge);
+    }
+
+  private:
+    // Which relations skip an edge, indexed like Relations
+    using SkippedRelations = std::array<bool, NUM_RELATIONS>;
+
+    size_t initial_round_size;
+
+    // Workspace kept across rounds: one accumulator and one set of edges and extended edges per thread, and the pow
+    // challenges.
+    std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators;
+    std::vector<Edges> thread_edges;
+    std::vector<ExtendedEdges> thread_extended_edges;
+    std::vector<FF> pow_challenges;
+
+    /**
+     * @brief compute_univariate, calling prepare_edge(edge_idx) on each edge before reading it.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename PrepareEdge>
+    barretenberg::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> compute_univariate_over_edges(
+        ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+        const proof_system::RelationParameters<FF>& relation_parameters,
+        const barretenberg::PowUnivariate<FF>& pow_univariate,
+        const FF alpha,
+        const PrepareEdge& prepare_edge)
+    {
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads =
-            barretenberg::thread_utils::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
-
-        // Constuct univariate accumulator containers; one per thread
-        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
-        for (auto& accum : thread_univariate_accumulators) {
-            Utils::zero_univariates(accum);
-        }
+        // The number of threads is a power of 2, for the pairwise sum of their accumulators. The edges in the padding
+        // contribute nothing, so the work is split over the others.
+        const auto [first_padding_edge, last_padding_edge] = get_padding_edges(round_size);
+        const size_t num_edges = (round_size >> 1) - (last_padding_edge - first_padding_edge);
+        num_edges_read_per_round.push_back(num_edges);
+        size_t num_threads = calculate_num_threads(2 * num_edges);
+        size_t edges_per_thread = (num_edges + num_threads - 1) / num_threads;
+        reserve_workspace(round_size);
 
-        // Constuct extended edge containers; one per thread
-        std::vector<ExtendedEdges> extended_edges;
-        extended_edges.resize(num_threads);
+        compute_pow_challenges(pow_univariate, num_threads);
 
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
         parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
+            size_t start = std::min(thread_idx * edges_per_thread, num_edges);
+            size_t end = std::min(start + edges_per_thread, num_edges);
+            auto& accumulators = thread_univariate_accumulators[thread_idx];
+            Utils::zero_univariates(accumulators);
 
             // For each edge_idx = 2i, we need to multiply the whole contribution by zeta^{2^{2i}}
             // This means that each univariate for each relation needs an extra multiplication.
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
+            for (size_t i = start; i < end; ++i) {
+                const size_t edge_idx = 2 * get_edge(i, first_padding_edge, last_padding_edge);
+                prepare_edge(edge_idx);
+                auto& edges = thread_edges[thread_idx];
+                for (auto [edge, multivariate] : zip_view(edges.pointer_view(), polynomials.pointer_view())) {
+                    *edge =
+                        barretenberg::Univariate<FF, 2>({ (*multivariate)[edge_idx], (*multivariate)[edge_idx + 1] });
+                }
+
+                // Relations that can tell when an edge contributes nothing to them skip it. Their predicates are linear
+                // in the edge values, so they hold on the extended edge exactly when they hold on the two rows, and an
+                // edge every relation skips is never extended.
+                SkippedRelations skipped{};
+                compute_skipped_relations(skipped, edges, relation_parameters);
+                if (std::all_of(skipped.begin(), skipped.end(), [](bool skip) { return skip; })) {
+                    continue;
+                }
+                auto& extended_edges = thread_extended_edges[thread_idx];
+                for (auto [extended_edge, edge] : zip_view(extended_edges.pointer_view(), edges.pointer_view())) {
+                    *extended_edge = edge->template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+                }
 
                 // Update the pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the next edge.
                 FF pow_challenge = pow_challenges[edge_idx >> 1];
@@ -152,23 +281,121 @@ template <typename Flavor> class SumcheckProverRound {
                 // Compute the i-th edge's univariate contribution,
                 // scale it by the pow polynomial's constant and zeta power "c_l ⋅ ζ_{l+1}ⁱ"
                 // and add it to the accumulators for Sˡ(Xₗ)
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_challenge);
+                accumulate_relation_univariates(
+                    accumulators, extended_edges, relation_parameters, pow_challenge, skipped);
             }
         });
 
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
-        for (auto& accumulators : thread_univariate_accumulators) {
-            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        // Accumulate the per-thread univariate accumulators pairwise, in log(num_threads) parallel steps
+        for (size_t stride = 1; stride < num_threads; stride <<= 1) {
+            parallel_for(num_threads / (2 * stride), [&](size_t pair_idx) {
+                Utils::add_nested_tuples(thread_univariate_accumulators[2 * stride * pair_idx],
+                                         thread_univariate_accumulators[2 * stride * pair_idx + stride]);
+            });
         }
+        Utils::add_nested_tuples(univariate_accumulators, thread_univariate_accumulators[0]);
         // Batch the univariate contributions from each sub-relation to obtain the round univariate
         return Utils::template batch_over_relations<barretenberg::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>>(
             univariate_accumulators, alpha, pow_univariate);
     }
 
-  private:
+    /**
+     * @brief The power of 2 number of threads for a round of the given size: one per MIN_ITERATIONS_PER_THREAD edges,
+     * at most max_num_threads and at least 1.
+     */
+    size_t calculate_num_threads(size_t size) const
+    {
+        const size_t desired_num_threads = size / MIN_ITERATIONS_PER_THREAD;
+        if (desired_num_threads == 0) {
+            return 1;
+        }
+        return std::min(static_cast<size_t>(1ULL << numeric::get_msb(desired_num_threads)), max_num_threads);
+    }
+
+    void reserve_workspace(size_t max_round_size)
+    {
+        size_t num_threads = calculate_num_threads(max_round_size);
+        if (thread_univariate_accumulators.size() < num_threads) {
+            thread_univariate_accumulators.resize(num_threads);
+            thread_edges.resize(num_threads);
+            thread_extended_edges.resize(num_threads);
+        }
+        pow_challenges.reserve(max_round_size >> 1);
+    }
+
+    /**
+     * @brief The i-th edge of a round outside its padding edges [first_padding_edge, last_padding_edge)
+     */
+    static size_t get_edge(size_t i, size_t first_padding_edge, size_t last_padding_edge)
+    {
+        return i < first_padding_edge ? i : i + (last_padding_edge - first_padding_edge);
+    }
+
+    /**
+     * @brief Zero the first and last padding edges of a folded polynomial. These are the only padding rows that a
+     * later round reads, when folding the edges next to them.
+     */
+    static void zero_padding_boundary(FF* folded, size_t first_padding_edge, size_t last_padding_edge)
+    {
+        for (size_t row : { 2 * first_padding_edge, 2 * last_padding_edge - 2 }) {
+            folded[row] = FF(0);
+            folded[row + 1] = FF(0);
+        }
+    }
+
+    /**
+     * @brief Fold the previous round's polynomials across this round's padding edges: the polynomials that are not
+     * zero on the padding rows are folded there, and the others get zeros on the boundary of the padding.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename PartiallyEvaluatedMultivariates>
+    void fold_padding_edges(const ProverPolynomialsOrPartiallyEvaluatedMultivariates& previous_polynomials,
+                            PartiallyEvaluatedMultivariates& folded_polynomials,
+                            const FF previous_round_challenge)
+    {
+        const auto [first, last] = get_padding_edges(round_size);
+        if (first == last) {
+            return;
+        }
+        auto previous_view = previous_polynomials.pointer_view();
+        auto folded_view = folded_polynomials.pointer_view();
+        parallel_for(folded_view.size(), [&](size_t j) {
+            FF* folded = &(*folded_view[j])[0];
+            if (zero_on_padding[j]) {
+                zero_padding_boundary(folded, first, last);
+            } else {
+                barretenberg::field_lanes::interpolate_pairs(
+                    &(*previous_view[j])[4 * first], previous_round_challenge, folded + 2 * first, 2 * (last - first));
+            }
+        });
+    }
+
+    /**
+     * @brief Compute pow_challenges[i] = c_l ⋅ ζ_{l+1}ⁱ for the edges of this round outside its padding.
+     *
+     * @details Each thread starts its block at c_l ⋅ ζ_{l+1}^start, so the blocks are filled independently. A block
+     * that spans the padding starts again after it.
+     */
+    void compute_pow_challenges(const barretenberg::PowUnivariate<FF>& pow_univariate, size_t num_threads)
+    {
+        const auto [first_padding_edge, last_padding_edge] = get_padding_edges(round_size);
+        const size_t num_edges = (round_size >> 1) - (last_padding_edge - first_padding_edge);
+        pow_challenges.resize(round_size >> 1);
+        const size_t edges_per_thread = (num_edges + num_threads - 1) / num_threads;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = std::min(thread_idx * edges_per_thread, num_edges);
+            const size_t end = std::min(start + edges_per_thread, num_edges);
+            for (size_t i = start; i < end; ++i) {
+                const size_t edge = get_edge(i, first_padding_edge, last_padding_edge);
+                if (i == start || edge == last_padding_edge) {
+                    pow_challenges[edge] = pow_univariate.partial_evaluation_constant *
+                                           pow_univariate.zeta_pow_sqr.pow(static_cast<uint64_t>(edge));
+                } else {
+                    pow_challenges[edge] = pow_challenges[edge - 1] * pow_univariate.zeta_pow_sqr;
+                }
+            }
+        });
+    }
+
     /**
      * @brief For a given edge, calculate the contribution of each relation to the prover round univariate (S_l in the
      * thesis).
@@ -188,16 +415,39 @@ template <typename Flavor> class SumcheckProverRound {
     void accumulate_relation_univariates(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
                                          const auto& extended_edges,
                                          const proof_system::RelationParameters<FF>& relation_parameters,
-                                         const FF& scaling_factor)
+                                         const FF& scaling_factor,
+                                         const SkippedRelations& skipped)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        Relation::accumulate(
-            std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        if (!skipped[relation_idx]) {
+            Relation::accumulate(
+                std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
             accumulate_relation_univariates<relation_idx + 1>(
-                univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
+                univariate_accumulators, extended_edges, relation_parameters, scaling_factor, skipped);
+        }
+    }
+
+    /**
+     * @brief For each relation with a skip predicate, record whether it holds on the (unextended) edges. Relations
+     * without one never skip.
+     */
+    template <size_t relation_idx = 0>
+    void compute_skipped_relations(SkippedRelations& skipped,
+                                   const Edges& edges,
+                                   const proof_system::RelationParameters<FF>& relation_parameters)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        if constexpr (requires { Relation::skip(edges, relation_parameters); }) {
+            skipped[relation_idx] = Relation::skip(edges, relation_parameters);
+        }
+
+        // Repeat for the next relation.
+        if constexpr (relation_idx + 1 < NUM_RELATIONS) {
+            compute_skipped_relations<relation_idx + 1>(skipped, edges, relation_parameters);
         }
     }
 };
@@ -130,6 +130,39 @@ TEST_F(ProtoGalaxyTests, PerturbatorCoefficients)
     }
 }
 
+// Large enough for the tree to be split across threads; checks F(X) = ∑ f_i ⋅ pow_i(β + X⋅δ) at a random point
+TEST_F(ProtoGalaxyTests, PerturbatorCoefficientsMultithreaded)
+{
+    const size_t log_instance_size(12);
+    const size_t instance_size(1 << log_instance_size);
+
+    std::vector<FF> betas(log_instance_size);
+    std::vector<FF> deltas(log_instance_size);
+    for (size_t idx = 0; idx < log_instance_size; idx++) {
+        betas[idx] = FF::random_element();
+        deltas[idx] = FF::random_element();
+    }
+    std::vector<FF> full_honk_evaluations(instance_size);
+    for (auto& eval : full_honk_evaluations) {
+        eval = FF::random_element();
+    }
+
+    auto perturbator = ProtoGalaxyProver::construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
+    EXPECT_EQ(perturbator.size(), log_instance_size + 1);
+
+    auto challenge = FF::random_element();
+    std::vector<FF> betas_at_challenge(log_instance_size);
+    for (size_t idx = 0; idx < log_instance_size; idx++) {
+        betas_at_challenge[idx] = betas[idx] + challenge * deltas[idx];
+    }
+    auto pow_betas = ProtoGalaxyProver::compute_pow_polynomial_at_values(betas_at_challenge, instance_size);
+    auto expected = FF(0);
+    for (size_t i = 0; i < instance_size; i++) {
+        expected += full_honk_evaluations[i] * pow_betas[i];
+    }
+    EXPECT_EQ(barretenberg::Polynomial<FF>(perturbator).evaluate(challenge), expected);
+}
+
 TEST_F(ProtoGalaxyTests, PerturbatorPolynomial)
 {
     const size_t log_instance_size(3);
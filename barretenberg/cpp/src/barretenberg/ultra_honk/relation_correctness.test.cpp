@@ -2,6 +2,7 @@
 #include "barretenberg/honk/proof_system/permutation_library.hpp"
 #include "barretenberg/proof_system/library/grand_product_library.hpp"
 #include "barretenberg/relations/auxiliary_relation.hpp"
+#include "barretenberg/relations/databus_lookup_relation.hpp"
 #include "barretenberg/relations/ecc_op_queue_relation.hpp"
 #include "barretenberg/relations/elliptic_relation.hpp"
 #include "barretenberg/relations/gen_perm_sort_relation.hpp"
@@ -11,6 +12,7 @@
 #include "barretenberg/relations/ultra_arithmetic_relation.hpp"
 #include "barretenberg/ultra_honk/ultra_composer.hpp"
 #include <gtest/gtest.h>
+#include <unordered_set>
 
 using namespace proof_system::honk;
 
@@ -95,6 +97,44 @@ void check_linearly_dependent_relation(auto circuit_size, auto polynomials, auto
     }
 }
 
+/**
+ * @brief Check that a relation contributes nothing at each row where its skip hook is true, and that the hook is true
+ * on every row in [padding_start, padding_end)
+ *
+ * @return The number of rows the relation would skip
+ */
+template <typename Flavor, typename Relation>
+size_t check_relation_skip(
+    auto circuit_size, auto polynomials, auto params, const size_t padding_start, const size_t padding_end)
+{
+    using AllValues = typename Flavor::AllValues;
+    size_t num_skipped_rows = 0;
+    for (size_t i = 0; i < circuit_size; i++) {
+        AllValues evaluations_at_index_i;
+        for (auto [eval, poly] : zip_view(evaluations_at_index_i.pointer_view(), polynomials.pointer_view())) {
+            *eval = (*poly)[i];
+        }
+        const bool skip = Relation::skip(evaluations_at_index_i, params);
+        if (i >= padding_start && i < padding_end) {
+            EXPECT_TRUE(skip) << "padding row " << i;
+        }
+        if (!skip) {
+            continue;
+        }
+        ++num_skipped_rows;
+
+        typename Relation::SumcheckArrayOfValuesOverSubrelations result;
+        for (auto& element : result) {
+            element = 0;
+        }
+        Relation::accumulate(result, evaluations_at_index_i, params, 1);
+        for (auto& element : result) {
+            EXPECT_EQ(element, 0);
+        }
+    }
+    return num_skipped_rows;
+}
+
 template <typename Flavor> void create_some_add_gates(auto& circuit_builder)
 {
     using FF = typename Flavor::FF;
@@ -365,6 +405,81 @@ TEST_F(RelationCorrectnessTests, GoblinUltraRelationCorrectness)
         circuit_size, prover_polynomials, params);
 }
 
+/**
+ * @brief Check the skip hooks of every GoblinUltra relation against a real execution trace
+ * @details Wherever a relation's skip hook is true, the relation must contribute zero, so sumcheck can leave the row
+ * out. Every relation must skip the padding rows between the gates and the sorted lookup values at the end of the
+ * trace. The ecc op queue and databus relations are only active on a few rows, so both must skip some rows but not
+ * all.
+ */
+TEST_F(RelationCorrectnessTests, GoblinUltraRelationSkip)
+{
+    using Flavor = flavor::GoblinUltra;
+    using FF = typename Flavor::FF;
+
+    auto builder = proof_system::GoblinUltraCircuitBuilder();
+    create_some_add_gates<Flavor>(builder);
+    create_some_lookup_gates<Flavor>(builder);
+    create_some_genperm_sort_gates<Flavor>(builder);
+    create_some_elliptic_curve_addition_gates<Flavor>(builder);
+    create_some_RAM_gates<Flavor>(builder);
+    create_some_ecc_op_queue_gates<Flavor>(builder);
+
+    auto composer = GoblinUltraComposer();
+    auto instance = composer.create_instance(builder);
+    auto circuit_size = instance->proving_key->circuit_size;
+
+    FF eta = FF::random_element();
+    FF beta = FF::random_element();
+    FF gamma = FF::random_element();
+
+    instance->initialize_prover_polynomials();
+
+    // The padding rows follow the zero row, ecc op gates, public inputs and gates. The sorted lookup values and then
+    // the tables fill the end of the trace, and the last padding row is excluded as its shifts read the first of them.
+    // The instance has appended each table's entries to its lookup gates, so these now count both.
+    size_t sorted_list_size = 0;
+    for (const auto& table : builder.lookup_tables) {
+        sorted_list_size += table.lookup_gates.size();
+    }
+    const size_t padding_start = instance->pub_inputs_offset + instance->public_inputs.size() + builder.num_gates;
+    const size_t padding_end = circuit_size - sorted_list_size - 1;
+    ASSERT_LT(padding_start, padding_end);
+    // Sumcheck leaves out the padding the instance reports
+    EXPECT_EQ(instance->padding_start, padding_start);
+    EXPECT_EQ(instance->padding_end, padding_end);
+
+    instance->compute_sorted_accumulator_polynomials(eta);
+    instance->compute_logderivative_inverse(beta, gamma);
+    instance->compute_grand_product_polynomials(beta, gamma);
+
+    auto prover_polynomials = instance->prover_polynomials;
+    auto params = instance->relation_parameters;
+
+    check_relation_skip<Flavor, proof_system::UltraArithmeticRelation<FF>>(
+        circuit_size, prover_polynomials, params, padding_start, padding_end);
+    check_relation_skip<Flavor, proof_system::UltraPermutationRelation<FF>>(
+        circuit_size, prover_polynomials, params, padding_start, padding_end);
+    check_relation_skip<Flavor, proof_system::LookupRelation<FF>>(
+        circuit_size, prover_polynomials, params, padding_start, padding_end);
+    check_relation_skip<Flavor, proof_system::GenPermSortRelation<FF>>(
+        circuit_size, prover_polynomials, params, padding_start, padding_end);
+    check_relation_skip<Flavor, proof_system::EllipticRelation<FF>>(
+        circuit_size, prover_polynomials, params, padding_start, padding_end);
+    check_relation_skip<Flavor, proof_system::AuxiliaryRelation<FF>>(
+        circuit_size, prover_polynomials, params, padding_start, padding_end);
+
+    const size_t ecc_op_skipped_rows = check_relation_skip<Flavor, proof_system::EccOpQueueRelation<FF>>(
+        circuit_size, prover_polynomials, params, padding_start, padding_end);
+    EXPECT_GT(ecc_op_skipped_rows, 0UL);
+    EXPECT_LT(ecc_op_skipped_rows, circuit_size);
+
+    const size_t databus_skipped_rows = check_relation_skip<Flavor, proof_system::DatabusLookupRelation<FF>>(
+        circuit_size, prover_polynomials, params, padding_start, padding_end);
+    EXPECT_GT(databus_skipped_rows, 0UL);
+    EXPECT_LT(databus_skipped_rows, circuit_size);
+}
+
 /**
  * @brief Test the correctness of GolbinTranslator's Permutation Relation
  *
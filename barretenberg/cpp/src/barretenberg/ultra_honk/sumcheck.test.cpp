@@ -177,4 +177,75 @@ TEST_F(SumcheckTestsRealCircuit, Ultra)
     ASSERT_TRUE(verified);
 }
 
+/**
+ * @brief Sumcheck leaves out the padding rows of an instance: it makes the same proof as over every row, and each
+ * round reads no more edges than cover the rows outside the padding
+ *
+ */
+TEST_F(SumcheckTestsRealCircuit, Padding)
+{
+    using Flavor = flavor::Ultra;
+    using FF = typename Flavor::FF;
+
+    // A few hundred gates, so that the padding takes up much of the trace
+    auto builder = proof_system::UltraCircuitBuilder();
+    uint32_t a_idx = builder.add_public_variable(FF::random_element());
+    for (size_t i = 0; i < 300; i++) {
+        FF b = FF::random_element();
+        uint32_t b_idx = builder.add_variable(b);
+        uint32_t c_idx = builder.add_variable(builder.get_variable(a_idx) + b);
+        builder.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+        a_idx = c_idx;
+    }
+
+    auto composer = UltraComposer();
+    auto instance = composer.create_instance(builder);
+    instance->initialize_prover_polynomials();
+    instance->compute_sorted_accumulator_polynomials(FF::random_element());
+    instance->compute_grand_product_polynomials(FF::random_element(), FF::random_element());
+
+    const size_t circuit_size = instance->proving_key->circuit_size;
+    const size_t multivariate_d = numeric::get_msb(circuit_size);
+    const size_t num_unpadded_rows = circuit_size - (instance->padding_end - instance->padding_start);
+    ASSERT_LT(num_unpadded_rows, circuit_size * 3 / 4);
+
+    Flavor::Transcript expected_transcript = Flavor::Transcript::prover_init_empty();
+    auto expected_output = SumcheckProver<Flavor>(circuit_size, expected_transcript)
+                               .prove(instance->prover_polynomials, instance->relation_parameters);
+
+    // Both the fused and the unfused rounds, on one thread and with a thread block spanning the padding
+    for (const bool fuse_rounds : { true, false }) {
+        for (const size_t max_num_threads : { 1UL, 8UL }) {
+            Flavor::Transcript transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(circuit_size, transcript);
+            sumcheck.fuse_rounds = fuse_rounds;
+            sumcheck.round.max_num_threads = max_num_threads;
+            auto output = sumcheck.prove(instance);
+
+            EXPECT_EQ(transcript.proof_data, expected_transcript.proof_data);
+            EXPECT_EQ(output.challenge, expected_output.challenge);
+            auto expected_evaluations = expected_output.claimed_evaluations.pointer_view();
+            for (auto [eval, expected] : zip_view(output.claimed_evaluations.pointer_view(), expected_evaluations)) {
+                EXPECT_EQ(*eval, *expected);
+            }
+
+            // An edge of round r covers 2^{r+1} rows, and only the two that straddle the ends of the padding hold
+            // rows of both kinds
+            ASSERT_EQ(sumcheck.round.num_edges_read_per_round.size(), multivariate_d);
+            for (size_t round_idx = 0; round_idx < multivariate_d; round_idx++) {
+                const size_t rows_per_edge = 2UL << round_idx;
+                EXPECT_LE(sumcheck.round.num_edges_read_per_round[round_idx],
+                          (num_unpadded_rows + rows_per_edge - 1) / rows_per_edge + 2)
+                    << "round " << round_idx;
+            }
+            EXPECT_LT(sumcheck.round.num_edges_read_per_round[0], circuit_size * 3 / 8);
+
+            Flavor::Transcript verifier_transcript = Flavor::Transcript::verifier_init_empty(transcript);
+            auto verifier_output =
+                SumcheckVerifier<Flavor>(circuit_size).verify(instance->relation_parameters, verifier_transcript);
+            EXPECT_TRUE(verifier_output.verified.value());
+        }
+    }
+}
+
 } // namespace test_sumcheck_round
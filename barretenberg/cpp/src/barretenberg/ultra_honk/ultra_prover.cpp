@@ -49,8 +49,11 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitment
     // We only commit to the fourth wire polynomial after adding memory records
     auto wire_polys = instance->proving_key->get_wires();
     auto labels = commitment_labels.get_wires();
+    std::vector<std::span<const FF>> polys_to_commit;
+    std::vector<std::string> commitment_names;
     for (size_t idx = 0; idx < 3; ++idx) {
-        transcript.send_to_verifier(labels[idx], commitment_key->commit(wire_polys[idx]));
+        polys_to_commit.emplace_back(wire_polys[idx]);
+        commitment_names.emplace_back(labels[idx]);
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
@@ -58,13 +61,20 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitment
         auto op_wire_polys = instance->proving_key->get_ecc_op_wires();
         auto labels = commitment_labels.get_ecc_op_wires();
         for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
-            transcript.send_to_verifier(labels[idx], commitment_key->commit(op_wire_polys[idx]));
+            polys_to_commit.emplace_back(op_wire_polys[idx]);
+            commitment_names.emplace_back(labels[idx]);
         }
         // Commit to DataBus columns
-        transcript.send_to_verifier(commitment_labels.calldata,
-                                    commitment_key->commit(instance->proving_key->calldata));
-        transcript.send_to_verifier(commitment_labels.calldata_read_counts,
-                                    commitment_key->commit(instance->proving_key->calldata_read_counts));
+        polys_to_commit.emplace_back(instance->proving_key->calldata);
+        commitment_names.emplace_back(commitment_labels.calldata);
+        polys_to_commit.emplace_back(instance->proving_key->calldata_read_counts);
+        commitment_names.emplace_back(commitment_labels.calldata_read_counts);
+    }
+
+    // All of the above are known at this point, so commit to them in a single batched MSM
+    auto commitments = commitment_key->batch_commit(polys_to_commit);
+    for (size_t idx = 0; idx < commitments.size(); ++idx) {
+        transcript.send_to_verifier(commitment_names[idx], commitments[idx]);
     }
 }
 